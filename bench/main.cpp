@@ -0,0 +1,436 @@
+/**
+ * @file      main.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Benchmarks of the system primitives which do not need a system port.
+ *
+ * The program prints results in CSV format, or in JSON format if the --json argument is passed.
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include "Allocator.hpp"
+#include "Formatter.hpp"
+#include "MutexFacade.hpp"
+#include "HashMap.hpp"
+#include "PriorityQueue.hpp"
+#include "LockFreeStack.hpp"
+
+namespace eoos
+{
+namespace bench
+{
+
+/**
+ * @brief Result accumulator preventing a compiler from removing measured code.
+ */
+volatile uint64_t sink = 0;
+
+/**
+ * @brief Allocates and frees a memory block.
+ *
+ * @param i An iteration index.
+ */
+void allocate(int64_t const i)
+{
+    void* const ptr = Allocator::allocate(static_cast<size_t>(16 + (i & 0xFF)));
+    sink += reinterpret_cast<uintptr_t>(ptr) & 1U;
+    Allocator::free(ptr);
+}
+
+/**
+ * @brief Formats a 32-bit signed integer.
+ *
+ * @param i An iteration index.
+ */
+void formatInt32(int64_t const i)
+{
+    char_t buffer[Formatter::LENGTH_MAX];
+    sink += static_cast<uint64_t>( Formatter::format(static_cast<int32_t>(i * 7919), buffer) );
+}
+
+/**
+ * @brief Formats a 64-bit unsigned integer.
+ *
+ * @param i An iteration index.
+ */
+void formatUint64(int64_t const i)
+{
+    char_t buffer[Formatter::LENGTH_MAX];
+    sink += static_cast<uint64_t>( Formatter::format(static_cast<uint64_t>( static_cast<uint64_t>(i) * 0x9E3779B97F4A7C15ULL ), buffer) );
+}
+
+/**
+ * @brief Formats a single precision floating point number.
+ *
+ * @param i An iteration index.
+ */
+void formatFloat32(int64_t const i)
+{
+    char_t buffer[Formatter::LENGTH_MAX];
+    sink += static_cast<uint64_t>( Formatter::format(static_cast<float32_t>(i) * 0.001F, buffer) );
+}
+
+/**
+ * @brief Formats a double precision floating point number.
+ *
+ * @param i An iteration index.
+ */
+void formatFloat64(int64_t const i)
+{
+    char_t buffer[Formatter::LENGTH_MAX];
+    sink += static_cast<uint64_t>( Formatter::format(static_cast<float64_t>(i) * 1.0e-7 + 1.0 / 3.0, buffer) );
+}
+
+/**
+ * @class Flag
+ * @brief Mutex of one thread to measure cost of calls but not of locking.
+ *
+ * The state is volatile, so each lock and unlock is performed even if a call
+ * is inlined and a compiler cannot fold a loop of calls.
+ */
+class Flag : public api::Mutex
+{
+
+public:
+
+    Flag() :
+        isLocked_ (false){
+    }
+
+    virtual ~Flag()
+    {
+    }
+
+    virtual bool_t isConstructed() const
+    {
+        return true;
+    }
+
+    virtual bool_t tryLock()
+    {
+        bool_t const res = not isLocked_;
+        isLocked_ = true;
+        return res;
+    }
+
+    virtual bool_t lock()
+    {
+        isLocked_ = true;
+        return true;
+    }
+
+    virtual void unlock()
+    {
+        isLocked_ = false;
+    }
+
+    virtual Protocol getProtocol() const
+    {
+        return PROTOCOL_NONE;
+    }
+
+    virtual int32_t getCeiling() const
+    {
+        return -1;
+    }
+
+private:
+
+    volatile bool_t isLocked_;
+
+};
+
+/**
+ * @brief A mutex being measured.
+ */
+Flag flag;
+
+/**
+ * @brief A mutex interface hidden from a compiler to prevent devirtualization.
+ */
+api::Mutex* volatile mutex = &flag;
+
+/**
+ * @brief Number of operations of one iteration of mutex cases.
+ */
+const int32_t LOCK_BATCH = 64;
+
+/**
+ * @brief Locks and unlocks a mutex through the interface.
+ *
+ * @param i An iteration index.
+ */
+void lockVirtual(int64_t)
+{
+    MutexFacade<api::Mutex> facade(*mutex);
+    uint64_t count = 0;
+    for(int32_t j = 0; j < LOCK_BATCH; j++)
+    {
+        count += static_cast<uint64_t>( facade.lock() );
+        facade.unlock();
+    }
+    sink += count;
+}
+
+/**
+ * @brief Locks and unlocks a mutex through the bound facade.
+ *
+ * @param i An iteration index.
+ */
+void lockBound(int64_t)
+{
+    MutexFacade<Flag> facade(flag);
+    uint64_t count = 0;
+    for(int32_t j = 0; j < LOCK_BATCH; j++)
+    {
+        count += static_cast<uint64_t>( facade.lock() );
+        facade.unlock();
+    }
+    sink += count;
+}
+
+/**
+ * @brief Number of keys of lookup cases.
+ */
+const int32_t KEYS_NUMBER = 256;
+
+/**
+ * @brief Keys of lookup cases.
+ */
+int64_t keys[KEYS_NUMBER];
+
+/**
+ * @brief Values of the keys for the scan case.
+ */
+int32_t values[KEYS_NUMBER];
+
+/**
+ * @brief Returns a hash map of the keys.
+ *
+ * @return The hash map.
+ */
+HashMap<int64_t,int32_t>& getMap()
+{
+    static HashMap<int64_t,int32_t> map(-1);
+    if( map.isEmpty() )
+    {
+        for(int32_t i = 0; i < KEYS_NUMBER; i++)
+        {
+            keys[i] = static_cast<int64_t>(i) * 7919 + 13;
+            values[i] = i;
+            static_cast<void>( map.set(keys[i], values[i]) );
+        }
+    }
+    return map;
+}
+
+/**
+ * @brief Looks up a value of a key in a hash map.
+ *
+ * @param i An iteration index.
+ */
+void lookupMap(int64_t const i)
+{
+    static HashMap<int64_t,int32_t>& map = getMap();
+    sink += static_cast<uint64_t>( map.get(keys[i & (KEYS_NUMBER - 1)]) );
+}
+
+/**
+ * @brief Looks up a value of a key by scanning an array of keys.
+ *
+ * @param i An iteration index.
+ */
+void lookupScan(int64_t const i)
+{
+    static_cast<void>( getMap() );
+    int64_t const key = keys[i & (KEYS_NUMBER - 1)];
+    int32_t value = -1;
+    for(int32_t j = 0; j < KEYS_NUMBER; j++)
+    {
+        if(keys[j] == key)
+        {
+            value = values[j];
+            break;
+        }
+    }
+    sink += static_cast<uint64_t>(value);
+}
+
+/**
+ * @brief Inserts and removes a key of a hash map.
+ *
+ * @param i An iteration index.
+ */
+void insertMap(int64_t const i)
+{
+    static HashMap<int64_t,int32_t> map(-1);
+    int64_t const key = i & 0xFFF;
+    static_cast<void>( map.set(key, 1) );
+    sink += static_cast<uint64_t>( map.remove(key ^ 0x800) );
+}
+
+/**
+ * @brief Number of pending deadlines of the timer cases.
+ */
+const int32_t TIMERS_NUMBER = 256;
+
+/**
+ * @brief Returns a deadline following the head deadline.
+ *
+ * @param head A head deadline.
+ * @param i    An iteration index.
+ * @return The deadline.
+ */
+int64_t getDeadline(int64_t const head, int64_t const i)
+{
+    return head + 1 + ( (i * 2654435761LL) & 0x3FF );
+}
+
+/**
+ * @brief Expires the head deadline of a priority queue and schedules a new one.
+ *
+ * @param i An iteration index.
+ */
+void expireQueue(int64_t const i)
+{
+    static PriorityQueue<int64_t> queue(-1);
+    if( queue.isEmpty() )
+    {
+        for(int32_t j = 0; j < TIMERS_NUMBER; j++)
+        {
+            static_cast<void>( queue.add( getDeadline(0, j) ) );
+        }
+    }
+    int64_t const head = queue.peek();
+    static_cast<void>( queue.remove() );
+    static_cast<void>( queue.add( getDeadline(head, i) ) );
+    sink += static_cast<uint64_t>(head);
+}
+
+/**
+ * @brief Expires the head deadline of a sorted array and inserts a new one in order.
+ *
+ * @param i An iteration index.
+ */
+void expireSorted(int64_t const i)
+{
+    static int64_t deadlines[TIMERS_NUMBER];
+    static bool_t isFilled = false;
+    if( isFilled == false )
+    {
+        for(int32_t j = 0; j < TIMERS_NUMBER; j++)
+        {
+            deadlines[j] = getDeadline(0, j);
+        }
+        std::sort(deadlines, deadlines + TIMERS_NUMBER);
+        isFilled = true;
+    }
+    int64_t const head = deadlines[0];
+    int64_t const deadline = getDeadline(head, i);
+    int32_t j = 1;
+    while( (j < TIMERS_NUMBER) && (deadlines[j] < deadline) )
+    {
+        deadlines[j - 1] = deadlines[j];
+        j++;
+    }
+    deadlines[j - 1] = deadline;
+    sink += static_cast<uint64_t>(head);
+}
+
+/**
+ * @brief Pops and pushes a block of a lock-free free list.
+ *
+ * @param i An iteration index.
+ */
+void popPushStack(int64_t const i)
+{
+    static LockFreeStack<int64_t,64> stack;
+    int64_t block = i;
+    if( stack.pop(block) )
+    {
+        sink += static_cast<uint64_t>(block);
+    }
+    static_cast<void>( stack.push(block) );
+}
+
+/**
+ * @struct Case
+ * @brief A benchmark case.
+ */
+struct Case
+{
+    const char_t* name;
+    void (*function)(int64_t);
+    int32_t batch;
+};
+
+/**
+ * @brief Measures a benchmark case.
+ *
+ * @param function A function of a case.
+ * @param number   Number of iterations.
+ * @param batch    Number of operations of one iteration.
+ * @return Time of one operation in nanoseconds.
+ */
+float64_t measure(void (*function)(int64_t), int64_t const number, int32_t const batch)
+{
+    typedef std::chrono::steady_clock Clock;
+    Clock::time_point const start = Clock::now();
+    for(int64_t i = 0; i < number; i++)
+    {
+        function(i);
+    }
+    Clock::time_point const stop = Clock::now();
+    int64_t const time = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+    return static_cast<float64_t>(time) / static_cast<float64_t>(number * batch);
+}
+
+} // namespace bench
+} // namespace eoos
+
+int main(int argc, char** argv)
+{
+    using namespace eoos;
+    static const bench::Case CASES[] = {
+        {"Allocator.allocate.free", bench::allocate, 1},
+        {"Formatter.format.int32", bench::formatInt32, 1},
+        {"Formatter.format.uint64", bench::formatUint64, 1},
+        {"Formatter.format.float32", bench::formatFloat32, 1},
+        {"Formatter.format.float64", bench::formatFloat64, 1},
+        {"MutexFacade.lock.unlock.virtual", bench::lockVirtual, bench::LOCK_BATCH},
+        {"MutexFacade.lock.unlock.bound", bench::lockBound, bench::LOCK_BATCH},
+        {"HashMap.get.256", bench::lookupMap, 1},
+        {"Array.scan.256", bench::lookupScan, 1},
+        {"HashMap.set.remove", bench::insertMap, 1},
+        {"PriorityQueue.remove.add.256", bench::expireQueue, 1},
+        {"Array.insert.sorted.256", bench::expireSorted, 1},
+        {"LockFreeStack.pop.push", bench::popPushStack, 1}
+    };
+    static const int64_t ITERATIONS = 1000000;
+    bool_t const isJson = (argc > 1) && (std::strcmp(argv[1], "--json") == 0);
+    int32_t const number = static_cast<int32_t>( sizeof(CASES) / sizeof(CASES[0]) );
+    std::printf(isJson ? "[\n" : "name,iterations,ns_per_op\n");
+    for(int32_t i = 0; i < number; i++)
+    {
+        // Warm up caches and the allocator before measuring
+        static_cast<void>( bench::measure(CASES[i].function, ITERATIONS / 10, CASES[i].batch) );
+        float64_t const time = bench::measure(CASES[i].function, ITERATIONS, CASES[i].batch);
+        if(isJson)
+        {
+            std::printf("  {\"name\": \"%s\", \"iterations\": %lld, \"ns_per_op\": %.3f}%s\n",
+                CASES[i].name, static_cast<long long>(ITERATIONS), time, (i + 1 < number) ? "," : "");
+        }
+        else
+        {
+            std::printf("%s,%lld,%.3f\n", CASES[i].name, static_cast<long long>(ITERATIONS), time);
+        }
+    }
+    if(isJson)
+    {
+        std::printf("]\n");
+    }
+    return 0;
+}
@@ -8,6 +8,7 @@
 
 #include "api.Mutex.hpp"
 #include "api.SysResource.hpp"
+#include "api.SysThread.hpp"
 
 namespace eoos
 {
@@ -28,6 +29,20 @@ public:
      */
     virtual ~SysMutex() = 0;
 
+    /**
+     * @brief Returns a thread owning this mutex.
+     *
+     * @return The owner thread, or NULLPTR if this mutex is not locked.
+     */
+    virtual SysThread* getOwner() const = 0;
+
+    /**
+     * @brief Returns the highest priority of threads blocked on this mutex.
+     *
+     * @return Priority value, or Thread::PRIORITY_WRONG if no threads are blocked.
+     */
+    virtual int32_t getWaitersPriority() const = 0;
+
 };
 
 inline SysMutex::~SysMutex() {}
@@ -36,6 +36,13 @@ public:
      */
     virtual void sleep(int64_t millis, int32_t nanos = 0) = 0;
 
+    /**
+     * @brief Causes this thread to sleep until given time.
+     *
+     * @param time An absolute time in nanoseconds of the system running time.
+     */
+    virtual void sleepUntil(int64_t time) = 0;
+
     /**
      * @brief Blocks this thread on given resource and yields the task.
      *
@@ -43,6 +50,36 @@ public:
      */
     virtual void block(SysResource& res) = 0;
 
+    /**
+     * @brief Returns time of this thread being blocked on given resource.
+     *
+     * @param res A resource.
+     * @return Cumulative time in nanoseconds, or -1 if an error has been occurred.
+     */
+    virtual int64_t getResourceTime(const SysResource& res) const = 0;
+
+    /**
+     * @brief Returns a priority this thread is being scheduled with.
+     *
+     * The effective priority differs from the priority set by a user
+     * while this thread is boosted by a mutex priority protocol.
+     *
+     * @return Priority value, or PRIORITY_WRONG if an error has been occurred.
+     */
+    virtual int32_t getEffectivePriority() const = 0;
+
+    /**
+     * @brief Sets a priority this thread is being scheduled with.
+     *
+     * The method is called by mutexes on locking and unlocking to boost an owner thread
+     * to the maximum of its own priority, ceilings of owned mutexes and priorities of threads
+     * blocked on them, and the PRIORITY_WRONG value restores the priority set by a user.
+     *
+     * @param priority Number of priority in range [PRIORITY_MIN, PRIORITY_MAX], PRIORITY_LOCK, or PRIORITY_WRONG.
+     * @return True if priority is set.
+     */
+    virtual bool_t setEffectivePriority(int32_t priority) = 0;
+
 };
 
 inline SysThread::~SysThread() {}
@@ -0,0 +1,133 @@
+/**
+ * @file      ArrayCopy.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef ARRAY_COPY_HPP_
+#define ARRAY_COPY_HPP_
+
+#include "Types.hpp"
+
+#if EOOS_CPP_STANDARD >= 2011
+#include <cstring>
+#include <type_traits>
+#endif // EOOS_CPP_STANDARD >= 2011
+
+namespace eoos
+{
+
+/**
+ * @struct ArrayCopy<T,IS_TRIVIAL>
+ * @brief Copy functions of arrays of elements.
+ *
+ * The template copies elements one by one by the assignment operators, and moves
+ * them under C++11. It is specialized for trivially copyable types under C++11,
+ * which arrays are copied by one memory copy.
+ *
+ * @tparam T          Data type of element.
+ * @tparam IS_TRIVIAL The data type is trivially copyable.
+ */
+#if EOOS_CPP_STANDARD >= 2011
+template <typename T, bool_t IS_TRIVIAL = std::is_trivially_copyable<T>::value>
+#else
+template <typename T, bool_t IS_TRIVIAL = false>
+#endif // EOOS_CPP_STANDARD >= 2011
+struct ArrayCopy
+{
+    /**
+     * @brief Copies elements of an array to another array.
+     *
+     * @param dst    An array elements are copied to.
+     * @param src    An array of elements, which does not overlap the other array.
+     * @param number A number of elements.
+     */
+    static void copy(T* const dst, const T* const src, int32_t const number)
+    {
+        for(int32_t i = 0; i < number; i++)
+        {
+            dst[i] = src[i];
+        }
+    }
+
+    /**
+     * @brief Moves elements of an array to another position of the array.
+     *
+     * @param dst    A position elements are moved to.
+     * @param src    A position of elements, which might overlap the other position,
+     *               and elements are not moved to themselves.
+     * @param number A number of elements.
+     */
+    static void move(T* const dst, T* const src, int32_t const number)
+    {
+        if(dst < src)
+        {
+            for(int32_t i = 0; i < number; i++)
+            {
+                assign(dst[i], src[i]);
+            }
+        }
+        else if(dst > src)
+        {
+            for(int32_t i = number - 1; i >= 0; i--)
+            {
+                assign(dst[i], src[i]);
+            }
+        }
+    }
+
+private:
+
+    /**
+     * @brief Moves an element to another element.
+     *
+     * @param dst An element the element is moved to.
+     * @param src An element.
+     */
+    static void assign(T& dst, T& src)
+    {
+        #if EOOS_CPP_STANDARD >= 2011
+        dst = static_cast<T&&>(src);
+        #else
+        dst = src;
+        #endif // EOOS_CPP_STANDARD >= 2011
+    }
+};
+
+#if EOOS_CPP_STANDARD >= 2011
+
+/**
+ * @struct ArrayCopy<T,true>
+ * @brief Copy functions of arrays of trivially copyable elements.
+ *
+ * @tparam T Data type of element.
+ */
+template <typename T>
+struct ArrayCopy<T, true>
+{
+    /**
+     * @copydoc eoos::ArrayCopy::copy(T*,const T*,int32_t)
+     */
+    static void copy(T* const dst, const T* const src, int32_t const number)
+    {
+        if(number > 0)
+        {
+            static_cast<void>( std::memcpy(dst, src, sizeof(T) * static_cast<size_t>(number)) );
+        }
+    }
+
+    /**
+     * @copydoc eoos::ArrayCopy::move(T*,T*,int32_t)
+     */
+    static void move(T* const dst, T* const src, int32_t const number)
+    {
+        if(number > 0)
+        {
+            static_cast<void>( std::memmove(dst, src, sizeof(T) * static_cast<size_t>(number)) );
+        }
+    }
+};
+
+#endif // EOOS_CPP_STANDARD >= 2011
+
+} // namespace eoos
+#endif // ARRAY_COPY_HPP_
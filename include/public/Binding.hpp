@@ -0,0 +1,66 @@
+/**
+ * @file      Binding.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Compile time binding of interfaces to classes implementing them.
+ *
+ * A build with one known implementation of an interface might define a macro
+ * of the implementation class, thus functions of the class are called directly
+ * through a facade, otherwise they are called through the interface virtually:
+ * - EOOS_BIND_MUTEX is a mutex class, for example, eoos::sys::Mutex;
+ * - EOOS_BIND_QUEUE is a queue class template, for example, eoos::lib::CircularList;
+ * - EOOS_BIND_LIST is a list class template, for example, eoos::lib::LinkedList.
+ *
+ * The classes must be declared before the file is included.
+ */
+#ifndef BINDING_HPP_
+#define BINDING_HPP_
+
+#include "MutexFacade.hpp"
+#include "QueueFacade.hpp"
+#include "ListFacade.hpp"
+
+namespace eoos
+{
+
+#ifdef EOOS_BIND_MUTEX
+typedef MutexFacade<EOOS_BIND_MUTEX> BoundMutex;
+#else
+typedef MutexFacade<api::Mutex> BoundMutex;
+#endif // EOOS_BIND_MUTEX
+
+/**
+ * @struct BoundQueue<T>
+ * @brief Facade of a queue bound at compile time.
+ *
+ * @tparam T Data type of queue element.
+ */
+template <typename T>
+struct BoundQueue
+{
+    #ifdef EOOS_BIND_QUEUE
+    typedef QueueFacade< T, EOOS_BIND_QUEUE<T> > Type;
+    #else
+    typedef QueueFacade< T, api::Queue<T> > Type;
+    #endif // EOOS_BIND_QUEUE
+};
+
+/**
+ * @struct BoundList<T>
+ * @brief Facade of a list bound at compile time.
+ *
+ * @tparam T Data type of list element.
+ */
+template <typename T>
+struct BoundList
+{
+    #ifdef EOOS_BIND_LIST
+    typedef ListFacade< T, EOOS_BIND_LIST<T> > Type;
+    #else
+    typedef ListFacade< T, api::List<T> > Type;
+    #endif // EOOS_BIND_LIST
+};
+
+} // namespace eoos
+#endif // BINDING_HPP_
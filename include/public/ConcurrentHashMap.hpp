@@ -0,0 +1,378 @@
+/**
+ * @file      ConcurrentHashMap.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef CONCURRENT_HASH_MAP_HPP_
+#define CONCURRENT_HASH_MAP_HPP_
+
+#include "HashMap.hpp"
+#include "api.System.hpp"
+
+namespace eoos
+{
+
+#ifdef EOOS_NO_STRICT_MISRA_RULES
+
+/**
+ * @class ConcurrentHashMap<K,V,H,A>
+ * @brief Hash map shared by threads.
+ *
+ * The map splits keys into stripes by their hashes, and each stripe is a hash map
+ * guarded by its own fair system semaphore of READERS_MAX permits. A reader acquires
+ * one permit and a writer acquires all of them, so readers of one stripe do not block
+ * each other, and threads accessing keys of different stripes do not block each other
+ * at all. Thus the more stripes the map has, the less writers contend.
+ *
+ * @note A semaphore of the system must be fair, otherwise a writer acquiring all
+ * permits might wait for ever while readers acquire and release one permit.
+ *
+ * @note A reference returned by the get function of the api::Map interface is not guarded
+ * after the function returns, so shared values should be read by the copying get function.
+ *
+ * @tparam K Data type of map key.
+ * @tparam V Data type of map value.
+ * @tparam H Hash function class of keys.
+ * @tparam A Heap memory allocator class.
+ */
+template <typename K, typename V, class H = Hash<K>, class A = Allocator>
+class ConcurrentHashMap : public Object<A>, public api::Map<K,V>
+{
+    typedef Object<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param system  The operating system interface to create semaphores.
+     * @param stripes A number of stripes being a power of two.
+     * @param illegal An illegal value.
+     */
+    ConcurrentHashMap(api::System& system, int32_t const stripes, const V& illegal) : Parent(),
+        stripes_ (NULLPTR),
+        number_  (0),
+        illegal_ (illegal){
+        bool_t const isConstructed = construct(system, stripes);
+        this->setConstructed( isConstructed );
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~ConcurrentHashMap()
+    {
+        destruct();
+    }
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const
+    {
+        return Parent::isConstructed();
+    }
+
+    /**
+     * @copydoc eoos::api::Collection::getLength()
+     */
+    virtual int32_t getLength() const
+    {
+        int32_t length = 0;
+        if( isConstructed() )
+        {
+            for(int32_t i = 0; i < number_; i++)
+            {
+                Stripe& stripe = *stripes_[i];
+                if( stripe.semaphore->acquire() )
+                {
+                    length += stripe.map.getLength();
+                    stripe.semaphore->release();
+                }
+            }
+        }
+        return length;
+    }
+
+    /**
+     * @copydoc eoos::api::Collection::isEmpty()
+     */
+    virtual bool_t isEmpty() const
+    {
+        return getLength() == 0;
+    }
+
+    /**
+     * @copydoc eoos::api::Map::set(const K&, const V&)
+     */
+    virtual bool_t set(const K& key, const V& value)
+    {
+        bool_t res = false;
+        if( isConstructed() )
+        {
+            Stripe& stripe = getStripe(key);
+            if( stripe.semaphore->acquire(READERS_MAX) )
+            {
+                res = stripe.map.set(key, value);
+                stripe.semaphore->release(READERS_MAX);
+            }
+        }
+        return res;
+    }
+
+    /**
+     * @copydoc eoos::api::Map::remove(const K&)
+     */
+    virtual bool_t remove(const K& key)
+    {
+        bool_t res = false;
+        if( isConstructed() )
+        {
+            Stripe& stripe = getStripe(key);
+            if( stripe.semaphore->acquire(READERS_MAX) )
+            {
+                res = stripe.map.remove(key);
+                stripe.semaphore->release(READERS_MAX);
+            }
+        }
+        return res;
+    }
+
+    /**
+     * @copydoc eoos::api::Map::clear()
+     */
+    virtual void clear()
+    {
+        if( isConstructed() )
+        {
+            for(int32_t i = 0; i < number_; i++)
+            {
+                Stripe& stripe = *stripes_[i];
+                if( stripe.semaphore->acquire(READERS_MAX) )
+                {
+                    stripe.map.clear();
+                    stripe.semaphore->release(READERS_MAX);
+                }
+            }
+        }
+    }
+
+    /**
+     * @copydoc eoos::api::Map::get(const K&)
+     */
+    virtual V& get(const K& key) const
+    {
+        V* value = &illegal_;
+        if( isConstructed() )
+        {
+            Stripe& stripe = getStripe(key);
+            if( stripe.semaphore->acquire() )
+            {
+                if( stripe.map.isKey(key) )
+                {
+                    value = &stripe.map.get(key);
+                }
+                stripe.semaphore->release();
+            }
+        }
+        return *value;
+    }
+
+    /**
+     * @brief Copies a value associated with a key.
+     *
+     * @param key   A key.
+     * @param value A variable the value is copied to.
+     * @return True if the value is copied, or false if this container does not contain the key.
+     */
+    bool_t get(const K& key, V& value) const
+    {
+        bool_t res = false;
+        if( isConstructed() )
+        {
+            Stripe& stripe = getStripe(key);
+            if( stripe.semaphore->acquire() )
+            {
+                if( stripe.map.isKey(key) )
+                {
+                    value = stripe.map.get(key);
+                    res = true;
+                }
+                stripe.semaphore->release();
+            }
+        }
+        return res;
+    }
+
+    /**
+     * @copydoc eoos::api::Map::isKey(const K&)
+     */
+    virtual bool_t isKey(const K& key) const
+    {
+        bool_t res = false;
+        if( isConstructed() )
+        {
+            Stripe& stripe = getStripe(key);
+            if( stripe.semaphore->acquire() )
+            {
+                res = stripe.map.isKey(key);
+                stripe.semaphore->release();
+            }
+        }
+        return res;
+    }
+
+    /**
+     * @copydoc eoos::api::IllegalValue::getIllegal()
+     */
+    virtual V& getIllegal() const
+    {
+        return illegal_;
+    }
+
+    /**
+     * @copydoc eoos::api::IllegalValue::setIllegal(const T&)
+     */
+    virtual void setIllegal(const V& value)
+    {
+        illegal_ = value;
+    }
+
+    /**
+     * @copydoc eoos::api::IllegalValue::isIllegal(const T&)
+     */
+    virtual bool_t isIllegal(const V& value) const
+    {
+        return illegal_ == value;
+    }
+
+private:
+
+    /**
+     * @struct Stripe
+     * @brief A hash map of a part of keys and its semaphore.
+     */
+    struct Stripe : public ObjectAllocator<A>
+    {
+        explicit Stripe(const V& illegal) : ObjectAllocator<A>(),
+            map       (illegal),
+            semaphore (NULLPTR){
+        }
+
+        HashMap<K,V,H,A> map;
+        api::Semaphore* semaphore;
+    };
+
+    /**
+     * @brief Maximum number of threads reading one stripe at once.
+     */
+    static const int32_t READERS_MAX = 64;
+
+    /**
+     * @brief Allocates stripes.
+     *
+     * @param system  The operating system interface.
+     * @param stripes A number of stripes.
+     * @return True if the stripes are allocated.
+     */
+    bool_t construct(api::System& system, int32_t const stripes)
+    {
+        bool_t res = false;
+        if( (stripes > 0) && ( (stripes & (stripes - 1)) == 0 ) )
+        {
+            void* const memory = A::allocate( sizeof(Stripe*) * static_cast<size_t>(stripes) );
+            if(memory != NULLPTR)
+            {
+                stripes_ = reinterpret_cast<Stripe**>(memory);
+                res = true;
+                for(int32_t i = 0; i < stripes; i++)
+                {
+                    Stripe* const stripe = new Stripe(illegal_);
+                    stripes_[i] = stripe;
+                    number_ = i + 1;
+                    if( (stripe == NULLPTR) || (stripe->map.isConstructed() == false) )
+                    {
+                        res = false;
+                        break;
+                    }
+                    stripe->semaphore = system.createSemaphore(READERS_MAX, true);
+                    if( Parent::isConstructed(stripe->semaphore) == false )
+                    {
+                        res = false;
+                        break;
+                    }
+                }
+            }
+        }
+        return res;
+    }
+
+    /**
+     * @brief Frees stripes.
+     */
+    void destruct()
+    {
+        if(stripes_ != NULLPTR)
+        {
+            for(int32_t i = 0; i < number_; i++)
+            {
+                if(stripes_[i] != NULLPTR)
+                {
+                    delete stripes_[i]->semaphore;
+                    delete stripes_[i];
+                }
+            }
+            A::free(stripes_);
+        }
+    }
+
+    /**
+     * @brief Returns a stripe of a key.
+     *
+     * @param key A key.
+     * @return The stripe.
+     */
+    Stripe& getStripe(const K& key) const
+    {
+        // Other multiplier than the stripe maps use keeps keys of one stripe spread over its map
+        uint64_t const hash = H::hash(key) * 0xC2B2AE3D27D4EB4FULL;
+        int32_t const index = static_cast<int32_t>( (hash >> 32) & static_cast<uint64_t>(number_ - 1) );
+        return *stripes_[index];
+    }
+
+    /**
+     * @brief Copy constructor.
+     *
+     * @param obj Reference to a source object.
+     */
+    ConcurrentHashMap(const ConcurrentHashMap& obj);
+
+    /**
+     * @brief Copy assignment operator.
+     *
+     * @param obj Reference to a source object.
+     * @return Reference to this object.
+     */
+    ConcurrentHashMap& operator=(const ConcurrentHashMap& obj);
+
+    /**
+     * @brief Array of stripes.
+     */
+    Stripe** stripes_;
+
+    /**
+     * @brief Number of stripes.
+     */
+    int32_t number_;
+
+    /**
+     * @brief Illegal value.
+     */
+    mutable V illegal_;
+
+};
+
+#endif // EOOS_NO_STRICT_MISRA_RULES
+
+} // namespace eoos
+#endif // CONCURRENT_HASH_MAP_HPP_
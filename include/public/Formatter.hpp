@@ -0,0 +1,69 @@
+/**
+ * @file      Formatter.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef FORMATTER_HPP_
+#define FORMATTER_HPP_
+
+#include "Types.hpp"
+
+namespace eoos
+{
+ 
+/**
+ * @class Formatter
+ * @brief Numbers to characters converter.
+ *
+ * The class formats numbers to a caller buffer without heap memory allocation.
+ * Floating point numbers are formatted with the shortest sequence of digits
+ * which is enough to restore them exactly.
+ */ 
+class Formatter
+{
+
+public:
+
+    /**
+     * @brief Maximum number of characters including the terminating null character.
+     */
+    static const int32_t LENGTH_MAX = 32;
+
+    /**
+     * @brief Formats a number.
+     *
+     * @param value  A number to format.
+     * @param buffer A buffer of LENGTH_MAX characters at least.
+     * @return Number of characters not including the terminating null character.
+     */
+    static int32_t format(int32_t value, char_t* buffer);
+
+    /**
+     * @copydoc eoos::Formatter::format(int32_t, char_t*)
+     */
+    static int32_t format(uint32_t value, char_t* buffer);
+
+    /**
+     * @copydoc eoos::Formatter::format(int32_t, char_t*)
+     */
+    static int32_t format(int64_t value, char_t* buffer);
+
+    /**
+     * @copydoc eoos::Formatter::format(int32_t, char_t*)
+     */
+    static int32_t format(uint64_t value, char_t* buffer);
+
+    /**
+     * @copydoc eoos::Formatter::format(int32_t, char_t*)
+     */
+    static int32_t format(float32_t value, char_t* buffer);
+
+    /**
+     * @copydoc eoos::Formatter::format(int32_t, char_t*)
+     */
+    static int32_t format(float64_t value, char_t* buffer);
+
+};
+
+} // namespace eoos
+#endif // FORMATTER_HPP_
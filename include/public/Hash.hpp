@@ -0,0 +1,210 @@
+/**
+ * @file      Hash.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef HASH_HPP_
+#define HASH_HPP_
+
+#include "Types.hpp"
+
+namespace eoos
+{
+    
+/**
+ * @struct Hash<T>
+ * @brief Hash function of keys.
+ *
+ * The template is specialized for the standard integer types, so any fixed
+ * width integer type of any data model is hashed, and for pointer types, and
+ * other key types must specialize it with the static hash function
+ * which returns equal hashes for equal keys.
+ *
+ * @tparam T Data type of key.
+ */
+template <typename T>
+struct Hash;
+
+/**
+ * @struct Hash<signed char>
+ * @brief Hash function of signed char integer keys.
+ */
+template <>
+struct Hash<signed char>
+{
+    /**
+     * @brief Returns a hash of a key.
+     *
+     * @param key A key.
+     * @return The hash.
+     */
+    static uint64_t hash(signed char const key)
+    {
+        return static_cast<uint64_t>( static_cast<unsigned char>(key) );
+    }
+};
+
+/**
+ * @struct Hash<unsigned char>
+ * @brief Hash function of unsigned char integer keys.
+ */
+template <>
+struct Hash<unsigned char>
+{
+    /**
+     * @copydoc eoos::Hash<signed char>::hash(signed char)
+     */
+    static uint64_t hash(unsigned char const key)
+    {
+        return static_cast<uint64_t>(key);
+    }
+};
+
+/**
+ * @struct Hash<signed short>
+ * @brief Hash function of signed short integer keys.
+ */
+template <>
+struct Hash<signed short>
+{
+    /**
+     * @copydoc eoos::Hash<signed char>::hash(signed char)
+     */
+    static uint64_t hash(signed short const key)
+    {
+        return static_cast<uint64_t>( static_cast<unsigned short>(key) );
+    }
+};
+
+/**
+ * @struct Hash<unsigned short>
+ * @brief Hash function of unsigned short integer keys.
+ */
+template <>
+struct Hash<unsigned short>
+{
+    /**
+     * @copydoc eoos::Hash<signed char>::hash(signed char)
+     */
+    static uint64_t hash(unsigned short const key)
+    {
+        return static_cast<uint64_t>(key);
+    }
+};
+
+/**
+ * @struct Hash<signed int>
+ * @brief Hash function of signed int integer keys.
+ */
+template <>
+struct Hash<signed int>
+{
+    /**
+     * @copydoc eoos::Hash<signed char>::hash(signed char)
+     */
+    static uint64_t hash(signed int const key)
+    {
+        return static_cast<uint64_t>( static_cast<unsigned int>(key) );
+    }
+};
+
+/**
+ * @struct Hash<unsigned int>
+ * @brief Hash function of unsigned int integer keys.
+ */
+template <>
+struct Hash<unsigned int>
+{
+    /**
+     * @copydoc eoos::Hash<signed char>::hash(signed char)
+     */
+    static uint64_t hash(unsigned int const key)
+    {
+        return static_cast<uint64_t>(key);
+    }
+};
+
+/**
+ * @struct Hash<signed long>
+ * @brief Hash function of signed long integer keys.
+ */
+template <>
+struct Hash<signed long>
+{
+    /**
+     * @copydoc eoos::Hash<signed char>::hash(signed char)
+     */
+    static uint64_t hash(signed long const key)
+    {
+        return static_cast<uint64_t>( static_cast<unsigned long>(key) );
+    }
+};
+
+/**
+ * @struct Hash<unsigned long>
+ * @brief Hash function of unsigned long integer keys.
+ */
+template <>
+struct Hash<unsigned long>
+{
+    /**
+     * @copydoc eoos::Hash<signed char>::hash(signed char)
+     */
+    static uint64_t hash(unsigned long const key)
+    {
+        return static_cast<uint64_t>(key);
+    }
+};
+
+/**
+ * @struct Hash<signed long long>
+ * @brief Hash function of signed long long integer keys.
+ */
+template <>
+struct Hash<signed long long>
+{
+    /**
+     * @copydoc eoos::Hash<signed char>::hash(signed char)
+     */
+    static uint64_t hash(signed long long const key)
+    {
+        return static_cast<uint64_t>( static_cast<unsigned long long>(key) );
+    }
+};
+
+/**
+ * @struct Hash<unsigned long long>
+ * @brief Hash function of unsigned long long integer keys.
+ */
+template <>
+struct Hash<unsigned long long>
+{
+    /**
+     * @copydoc eoos::Hash<signed char>::hash(signed char)
+     */
+    static uint64_t hash(unsigned long long const key)
+    {
+        return static_cast<uint64_t>(key);
+    }
+};
+
+/**
+ * @struct Hash<T*>
+ * @brief Hash function of pointer keys.
+ *
+ * @tparam T Data type of pointed object.
+ */
+template <typename T>
+struct Hash<T*>
+{
+    /**
+     * @copydoc eoos::Hash<signed char>::hash(signed char)
+     */
+    static uint64_t hash(T* const key)
+    {
+        return static_cast<uint64_t>( reinterpret_cast<uintptr_t>(key) );
+    }
+};
+  
+} // namespace eoos
+#endif // HASH_HPP_
@@ -0,0 +1,571 @@
+/**
+ * @file      HashMap.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef HASH_MAP_HPP_
+#define HASH_MAP_HPP_
+
+#include "Object.hpp"
+#include "Hash.hpp"
+#include "api.Map.hpp"
+
+namespace eoos
+{
+
+#ifdef EOOS_NO_STRICT_MISRA_RULES
+
+/**
+ * @class HashMap<K,V,H,A>
+ * @brief Flat open addressing hash map.
+ *
+ * The map keeps keys and values in one array of slots, and an array of probe
+ * distances of the slots from home positions of their keys. Collisions are
+ * resolved by Robin Hood linear probing, thus a slot is given to a key which is
+ * further from its home, so probe sequences are short, and a lookup stops as soon
+ * as it meets a slot closer to its home than the key being looked up. Removal
+ * shifts following slots back, so the map has no tombstones.
+ *
+ * A probe distance is kept in one byte and saturates, and a saturated distance is
+ * computed from the home of the key. A long probe makes the map to be grown, unless
+ * the previous growth has not shortened it, so keys of one home for any number of
+ * slots are probed linearly instead of growing the map until memory is exhausted.
+ *
+ * @note Data types of keys and values must be default constructible and copy assignable,
+ * and keys must be compared by the equality operator.
+ *
+ * @tparam K Data type of map key.
+ * @tparam V Data type of map value.
+ * @tparam H Hash function class of keys.
+ * @tparam A Heap memory allocator class.
+ */
+template <typename K, typename V, class H = Hash<K>, class A = Allocator>
+class HashMap : public Object<A>, public api::Map<K,V>
+{
+    typedef Object<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    HashMap() : Parent(),
+        slots_      (NULLPTR),
+        distances_  (NULLPTR),
+        capacity_   (0),
+        bits_       (0),
+        length_     (0),
+        isGrowable_ (true),
+        illegal_    (){
+        bool_t const isConstructed = construct(CAPACITY_MIN);
+        this->setConstructed( isConstructed );
+    }
+
+    /**
+     * @brief Constructor.
+     *
+     * @param illegal An illegal value.
+     */
+    explicit HashMap(const V& illegal) : Parent(),
+        slots_      (NULLPTR),
+        distances_  (NULLPTR),
+        capacity_   (0),
+        bits_       (0),
+        length_     (0),
+        isGrowable_ (true),
+        illegal_    (illegal){
+        bool_t const isConstructed = construct(CAPACITY_MIN);
+        this->setConstructed( isConstructed );
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~HashMap()
+    {
+        destruct(slots_, distances_, capacity_);
+    }
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const
+    {
+        return Parent::isConstructed();
+    }
+
+    /**
+     * @copydoc eoos::api::Collection::getLength()
+     */
+    virtual int32_t getLength() const
+    {
+        return length_;
+    }
+
+    /**
+     * @copydoc eoos::api::Collection::isEmpty()
+     */
+    virtual bool_t isEmpty() const
+    {
+        return length_ == 0;
+    }
+
+    /**
+     * @copydoc eoos::api::Map::set(const K&, const V&)
+     */
+    virtual bool_t set(const K& key, const V& value)
+    {
+        bool_t res = false;
+        if( isConstructed() )
+        {
+            int32_t const index = find(key);
+            if(index >= 0)
+            {
+                slots_[index].value = value;
+                res = true;
+            }
+            else
+            {
+                res = true;
+                // Keep the load factor not greater than 7/8
+                if( (length_ + 1) * 8 > capacity_ * 7 )
+                {
+                    res = rehash(capacity_ * 2);
+                }
+                if(res == true)
+                {
+                    insert(key, value);
+                }
+            }
+        }
+        return res;
+    }
+
+    /**
+     * @copydoc eoos::api::Map::remove(const K&)
+     */
+    virtual bool_t remove(const K& key)
+    {
+        bool_t res = false;
+        if( isConstructed() )
+        {
+            int32_t index = find(key);
+            if(index >= 0)
+            {
+                int32_t next = (index + 1) & (capacity_ - 1);
+                while(distances_[next] > 0)
+                {
+                    slots_[index] = slots_[next];
+                    setDistance(index, getDistance(next) - 1);
+                    index = next;
+                    next = (next + 1) & (capacity_ - 1);
+                }
+                slots_[index] = Slot();
+                distances_[index] = EMPTY;
+                length_--;
+                res = true;
+            }
+        }
+        return res;
+    }
+
+    /**
+     * @copydoc eoos::api::Map::clear()
+     */
+    virtual void clear()
+    {
+        if( isConstructed() )
+        {
+            for(int32_t i = 0; i < capacity_; i++)
+            {
+                if(distances_[i] != EMPTY)
+                {
+                    slots_[i] = Slot();
+                    distances_[i] = EMPTY;
+                }
+            }
+            length_ = 0;
+        }
+    }
+
+    /**
+     * @copydoc eoos::api::Map::get(const K&)
+     */
+    virtual V& get(const K& key) const
+    {
+        int32_t index = -1;
+        if( isConstructed() )
+        {
+            index = find(key);
+        }
+        return (index >= 0) ? slots_[index].value : illegal_;
+    }
+
+    /**
+     * @copydoc eoos::api::Map::isKey(const K&)
+     */
+    virtual bool_t isKey(const K& key) const
+    {
+        bool_t res = false;
+        if( isConstructed() )
+        {
+            res = find(key) >= 0;
+        }
+        return res;
+    }
+
+    /**
+     * @copydoc eoos::api::IllegalValue::getIllegal()
+     */
+    virtual V& getIllegal() const
+    {
+        return illegal_;
+    }
+
+    /**
+     * @copydoc eoos::api::IllegalValue::setIllegal(const T&)
+     */
+    virtual void setIllegal(const V& value)
+    {
+        illegal_ = value;
+    }
+
+    /**
+     * @copydoc eoos::api::IllegalValue::isIllegal(const T&)
+     */
+    virtual bool_t isIllegal(const V& value) const
+    {
+        return illegal_ == value;
+    }
+
+private:
+
+    /**
+     * @struct Slot
+     * @brief A key and its value.
+     */
+    struct Slot : public ObjectAllocator<A>
+    {
+        Slot() : ObjectAllocator<A>(),
+            key   (),
+            value (){
+        }
+
+        K key;
+        V value;
+    };
+
+    /**
+     * @brief Probe distance of an empty slot.
+     */
+    static const int8_t EMPTY = -1;
+
+    /**
+     * @brief Saturated probe distance, which makes the map to be grown.
+     */
+    static const int8_t DISTANCE_MAX = 127;
+
+    /**
+     * @brief Initial number of slots.
+     */
+    static const int32_t CAPACITY_MIN = 8;
+
+    /**
+     * @brief Allocates and constructs arrays of slots and distances.
+     *
+     * @param capacity A number of slots being a power of two.
+     * @return True if the arrays are allocated.
+     */
+    bool_t construct(int32_t const capacity)
+    {
+        bool_t res = false;
+        void* const slots = A::allocate( sizeof(Slot) * static_cast<size_t>(capacity) );
+        void* const distances = A::allocate( static_cast<size_t>(capacity) );
+        if( (slots != NULLPTR) && (distances != NULLPTR) )
+        {
+            slots_ = reinterpret_cast<Slot*>(slots);
+            distances_ = reinterpret_cast<int8_t*>(distances);
+            for(int32_t i = 0; i < capacity; i++)
+            {
+                static_cast<void>( new (&slots_[i]) Slot() );
+                distances_[i] = EMPTY;
+            }
+            capacity_ = capacity;
+            bits_ = 0;
+            while( (1 << bits_) < capacity )
+            {
+                bits_++;
+            }
+            length_ = 0;
+            res = true;
+        }
+        else
+        {
+            A::free(slots);
+            A::free(distances);
+        }
+        return res;
+    }
+
+    /**
+     * @brief Destructs and frees arrays of slots and distances.
+     *
+     * @param slots     An array of slots.
+     * @param distances An array of distances.
+     * @param capacity  A number of slots.
+     */
+    static void destruct(Slot* const slots, int8_t* const distances, int32_t const capacity)
+    {
+        if(slots != NULLPTR)
+        {
+            for(int32_t i = 0; i < capacity; i++)
+            {
+                slots[i].~Slot();
+            }
+        }
+        A::free(slots);
+        A::free(distances);
+    }
+
+    /**
+     * @brief Returns a home position of a key.
+     *
+     * @param key A key.
+     * @return The position.
+     */
+    int32_t getHome(const K& key) const
+    {
+        // Fibonacci hashing spreads weak hashes over the whole array
+        uint64_t const hash = H::hash(key) * 0x9E3779B97F4A7C15ULL;
+        return static_cast<int32_t>( hash >> (64 - bits_) );
+    }
+
+    /**
+     * @brief Returns a probe distance of a slot.
+     *
+     * @param index A slot position.
+     * @return The distance, or a negative value if the slot is empty.
+     */
+    int32_t getDistance(int32_t const index) const
+    {
+        int32_t distance = distances_[index];
+        if(distance == DISTANCE_MAX)
+        {
+            distance = (index - getHome(slots_[index].key)) & (capacity_ - 1);
+        }
+        return distance;
+    }
+
+    /**
+     * @brief Sets a probe distance of a slot.
+     *
+     * @param index    A slot position.
+     * @param distance A distance.
+     */
+    void setDistance(int32_t const index, int32_t const distance)
+    {
+        distances_[index] = static_cast<int8_t>( (distance < DISTANCE_MAX) ? distance : DISTANCE_MAX );
+    }
+
+    /**
+     * @brief Finds a slot of a key.
+     *
+     * @param key A key.
+     * @return The slot position, or -1 if the key is not contained.
+     */
+    int32_t find(const K& key) const
+    {
+        int32_t res = -1;
+        int32_t index = getHome(key);
+        int32_t distance = 0;
+        while(true)
+        {
+            // Empty slots have negative distance, so they stop the probe as well
+            int32_t const current = getDistance(index);
+            if(current < distance)
+            {
+                break;
+            }
+            if( (current == distance) && (slots_[index].key == key) )
+            {
+                res = index;
+                break;
+            }
+            index = (index + 1) & (capacity_ - 1);
+            distance++;
+        }
+        return res;
+    }
+
+    /**
+     * @brief Inserts a key which is not contained.
+     *
+     * @param key   A key.
+     * @param value A value.
+     */
+    void insert(const K& key, const V& value)
+    {
+        if( isGrowable_ && isProbeLong( getHome(key) ) )
+        {
+            // The map is not grown any more if the growth has not shortened the probe
+            if( rehash(capacity_ * 2) && isProbeLong( getHome(key) ) )
+            {
+                isGrowable_ = false;
+            }
+        }
+        place(key, value);
+    }
+
+    /**
+     * @brief Places a key which is not contained to the slots.
+     *
+     * @param key   A key.
+     * @param value A value.
+     */
+    void place(const K& key, const V& value)
+    {
+        Slot slot;
+        slot.key = key;
+        slot.value = value;
+        int32_t index = getHome(key);
+        int32_t distance = 0;
+        while(true)
+        {
+            if(distances_[index] == EMPTY)
+            {
+                slots_[index] = slot;
+                setDistance(index, distance);
+                length_++;
+                break;
+            }
+            int32_t const current = getDistance(index);
+            if(current < distance)
+            {
+                // Take the slot from a key which is closer to its home
+                Slot const swapped = slots_[index];
+                slots_[index] = slot;
+                setDistance(index, distance);
+                slot = swapped;
+                distance = current;
+            }
+            index = (index + 1) & (capacity_ - 1);
+            distance++;
+        }
+    }
+
+    /**
+     * @brief Tests if an insertion to a home position carries a key to the maximum probe distance.
+     *
+     * @param home A home position of an inserting key.
+     * @return True if the map is to be grown before the insertion.
+     */
+    bool_t isProbeLong(int32_t const home) const
+    {
+        bool_t res = false;
+        int32_t index = home;
+        int32_t distance = 0;
+        // Follow the insertion by distances only, as the carried keys are not needed
+        while(distances_[index] != EMPTY)
+        {
+            int32_t const current = getDistance(index);
+            if(current < distance)
+            {
+                distance = current;
+            }
+            index = (index + 1) & (capacity_ - 1);
+            distance++;
+            if(distance >= DISTANCE_MAX)
+            {
+                res = true;
+                break;
+            }
+        }
+        return res;
+    }
+
+    /**
+     * @brief Moves all keys to new arrays.
+     *
+     * The old arrays are freed only after all keys have been moved,
+     * so the map keeps its keys if new arrays are not allocated.
+     *
+     * @param capacity A new number of slots.
+     * @return True if the keys are moved.
+     */
+    bool_t rehash(int32_t const capacity)
+    {
+        Slot* const slots = slots_;
+        int8_t* const distances = distances_;
+        int32_t const oldCapacity = capacity_;
+        bool_t const res = construct(capacity);
+        if(res == true)
+        {
+            for(int32_t i = 0; i < oldCapacity; i++)
+            {
+                if(distances[i] != EMPTY)
+                {
+                    place(slots[i].key, slots[i].value);
+                }
+            }
+            destruct(slots, distances, oldCapacity);
+            isGrowable_ = true;
+        }
+        return res;
+    }
+
+    /**
+     * @brief Copy constructor.
+     *
+     * @param obj Reference to a source object.
+     */
+    HashMap(const HashMap& obj);
+
+    /**
+     * @brief Copy assignment operator.
+     *
+     * @param obj Reference to a source object.
+     * @return Reference to this object.
+     */
+    HashMap& operator=(const HashMap& obj);
+
+    /**
+     * @brief Array of slots.
+     */
+    Slot* slots_;
+
+    /**
+     * @brief Array of probe distances of slots.
+     */
+    int8_t* distances_;
+
+    /**
+     * @brief Number of slots being a power of two.
+     */
+    int32_t capacity_;
+
+    /**
+     * @brief Binary logarithm of number of slots.
+     */
+    int32_t bits_;
+
+    /**
+     * @brief Number of contained keys.
+     */
+    int32_t length_;
+
+    /**
+     * @brief Growth of the map by long probes is allowed.
+     */
+    bool_t isGrowable_;
+
+    /**
+     * @brief Illegal value.
+     */
+    mutable V illegal_;
+
+};
+
+#endif // EOOS_NO_STRICT_MISRA_RULES
+
+} // namespace eoos
+#endif // HASH_MAP_HPP_
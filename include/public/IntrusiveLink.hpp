@@ -0,0 +1,105 @@
+/**
+ * @file      IntrusiveLink.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef INTRUSIVE_LINK_HPP_
+#define INTRUSIVE_LINK_HPP_
+
+#include "Types.hpp"
+
+namespace eoos
+{
+
+template <typename T, class K> class IntrusiveList;
+
+/**
+ * @class IntrusiveLink<K>
+ * @brief Link fields embedded into elements of intrusive lists.
+ *
+ * An element is linked to an intrusive list by deriving from this class, and
+ * an element derived from a few links of different tag types might be linked
+ * to a few lists at once.
+ *
+ * @note Copying an element does not copy its links, so a copy is not linked.
+ *
+ * @tparam K Tag type to distinguish links of one element.
+ */
+template <class K = void>
+class IntrusiveLink
+{
+    template <typename T, class L> friend class IntrusiveList;
+
+public:
+
+    /**
+     * @brief Tests if this element is linked to a list.
+     *
+     * @return True if the element is linked.
+     */
+    bool_t isLinked() const
+    {
+        return next_ != NULLPTR;
+    }
+
+protected:
+
+    /**
+     * @brief Constructor.
+     */
+    IntrusiveLink() :
+        prev_  (NULLPTR),
+        next_  (NULLPTR),
+        owner_ (NULLPTR){
+    }
+
+    /**
+     * @brief Copy constructor.
+     */
+    IntrusiveLink(const IntrusiveLink&) :
+        prev_  (NULLPTR),
+        next_  (NULLPTR),
+        owner_ (NULLPTR){
+    }
+
+    /**
+     * @brief Copy assignment operator.
+     *
+     * @return Reference to this object, which links are not changed.
+     */
+    IntrusiveLink& operator=(const IntrusiveLink&)
+    {
+        return *this;
+    }
+
+    /**
+     * @brief Destructor.
+     *
+     * The destructor is not virtual, so derived objects must not be deleted through this class,
+     * and an element must be removed from its list before being destructed.
+     */
+    ~IntrusiveLink()
+    {
+    }
+
+private:
+
+    /**
+     * @brief Previous link.
+     */
+    IntrusiveLink* prev_;
+
+    /**
+     * @brief Next link, or NULLPTR if this element is not linked.
+     */
+    IntrusiveLink* next_;
+
+    /**
+     * @brief Root link of the list this element is linked to, or NULLPTR if this element is not linked.
+     */
+    const IntrusiveLink* owner_;
+
+};
+
+} // namespace eoos
+#endif // INTRUSIVE_LINK_HPP_
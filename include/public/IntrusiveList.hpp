@@ -0,0 +1,318 @@
+/**
+ * @file      IntrusiveList.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef INTRUSIVE_LIST_HPP_
+#define INTRUSIVE_LIST_HPP_
+
+#include "IntrusiveLink.hpp"
+
+namespace eoos
+{
+
+/**
+ * @class IntrusiveList<T,K>
+ * @brief Doubly linked list of elements which embed their links.
+ *
+ * Unlike api::List, the list does not copy elements into allocated nodes, but links
+ * elements themselves, so elements must be derived from IntrusiveLink<K>. All
+ * the functions but clear are O(1), none of them allocates memory or calls virtual
+ * functions, so the list might be used inside a critical section of a disabled toggle.
+ * An element keeps the list it is linked to, so an element of another list is not
+ * removed from that list by mistake.
+ *
+ * @note The list does not own its elements, and an element must not be destructed
+ * while being linked.
+ *
+ * @tparam T Data type of list element derived from IntrusiveLink<K>.
+ * @tparam K Tag type of the link of elements used by the list.
+ */
+template <typename T, class K = void>
+class IntrusiveList
+{
+    typedef IntrusiveLink<K> Link;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    IntrusiveList() :
+        root_   (),
+        length_ (0){
+        root_.prev_ = &root_;
+        root_.next_ = &root_;
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~IntrusiveList()
+    {
+        clear();
+    }
+
+    /**
+     * @brief Returns a number of elements in this list.
+     *
+     * @return Number of elements.
+     */
+    int32_t getLength() const
+    {
+        return length_;
+    }
+
+    /**
+     * @brief Tests if this list has elements.
+     *
+     * @return True if this list does not contain any elements.
+     */
+    bool_t isEmpty() const
+    {
+        return length_ == 0;
+    }
+
+    /**
+     * @brief Inserts an element at the beginning of this list.
+     *
+     * @param element An element which is not linked.
+     * @return True if the element is inserted.
+     */
+    bool_t addFirst(T& element)
+    {
+        return link(*root_.next_, element);
+    }
+
+    /**
+     * @brief Inserts an element at the end of this list.
+     *
+     * @param element An element which is not linked.
+     * @return True if the element is inserted.
+     */
+    bool_t addLast(T& element)
+    {
+        return link(root_, element);
+    }
+
+    /**
+     * @brief Inserts an element before another element of this list.
+     *
+     * @param next    An element of this list.
+     * @param element An element which is not linked.
+     * @return True if the element is inserted, or false if the next element is not of this list.
+     */
+    bool_t addBefore(T& next, T& element)
+    {
+        bool_t res = false;
+        Link& position = next;
+        if( isElement(position) )
+        {
+            res = link(position, element);
+        }
+        return res;
+    }
+
+    /**
+     * @brief Removes an element from this list.
+     *
+     * @param element An element of this list.
+     * @return True if the element is removed, or false if the element is not of this list.
+     */
+    bool_t remove(T& element)
+    {
+        bool_t res = false;
+        Link& link = element;
+        if( isElement(link) )
+        {
+            unlink(link);
+            res = true;
+        }
+        return res;
+    }
+
+    /**
+     * @brief Removes the first element from this list.
+     *
+     * @return The removed element, or NULLPTR if this list is empty.
+     */
+    T* removeFirst()
+    {
+        T* const element = getFirst();
+        if(element != NULLPTR)
+        {
+            unlink(*element);
+        }
+        return element;
+    }
+
+    /**
+     * @brief Removes the last element from this list.
+     *
+     * @return The removed element, or NULLPTR if this list is empty.
+     */
+    T* removeLast()
+    {
+        T* const element = getLast();
+        if(element != NULLPTR)
+        {
+            unlink(*element);
+        }
+        return element;
+    }
+
+    /**
+     * @brief Removes all elements from this list.
+     */
+    void clear()
+    {
+        Link* link = root_.next_;
+        while(link != &root_)
+        {
+            Link* const next = link->next_;
+            link->prev_ = NULLPTR;
+            link->next_ = NULLPTR;
+            link->owner_ = NULLPTR;
+            link = next;
+        }
+        root_.prev_ = &root_;
+        root_.next_ = &root_;
+        length_ = 0;
+    }
+
+    /**
+     * @brief Returns the first element of this list.
+     *
+     * @return The first element, or NULLPTR if this list is empty.
+     */
+    T* getFirst() const
+    {
+        return getElement(root_.next_);
+    }
+
+    /**
+     * @brief Returns the last element of this list.
+     *
+     * @return The last element, or NULLPTR if this list is empty.
+     */
+    T* getLast() const
+    {
+        return getElement(root_.prev_);
+    }
+
+    /**
+     * @brief Returns an element following an element of this list.
+     *
+     * @param element An element of this list.
+     * @return The next element, or NULLPTR if the element is the last.
+     */
+    T* getNext(const T& element) const
+    {
+        const Link& link = element;
+        return getElement(link.next_);
+    }
+
+    /**
+     * @brief Returns an element preceding an element of this list.
+     *
+     * @param element An element of this list.
+     * @return The previous element, or NULLPTR if the element is the first.
+     */
+    T* getPrevious(const T& element) const
+    {
+        const Link& link = element;
+        return getElement(link.prev_);
+    }
+
+private:
+
+    /**
+     * @brief Links an element before a link.
+     *
+     * @param next    A link of this list or the root link.
+     * @param element An element.
+     * @return True if the element is linked.
+     */
+    bool_t link(Link& next, T& element)
+    {
+        bool_t res = false;
+        Link& link = element;
+        if( link.isLinked() == false )
+        {
+            link.prev_ = next.prev_;
+            link.next_ = &next;
+            link.owner_ = &root_;
+            next.prev_->next_ = &link;
+            next.prev_ = &link;
+            length_++;
+            res = true;
+        }
+        return res;
+    }
+
+    /**
+     * @brief Unlinks a linked link.
+     *
+     * @param link A link of this list.
+     */
+    void unlink(Link& link)
+    {
+        link.prev_->next_ = link.next_;
+        link.next_->prev_ = link.prev_;
+        link.prev_ = NULLPTR;
+        link.next_ = NULLPTR;
+        link.owner_ = NULLPTR;
+        length_--;
+    }
+
+    /**
+     * @brief Tests if a link is of an element of this list.
+     *
+     * @param link A link.
+     * @return True if the element is linked to this list.
+     */
+    bool_t isElement(const Link& link) const
+    {
+        return link.owner_ == &root_;
+    }
+
+    /**
+     * @brief Returns an element of a link.
+     *
+     * @param link A link of this list or the root link.
+     * @return The element, or NULLPTR for the root link.
+     */
+    T* getElement(Link* const link) const
+    {
+        return (link != &root_) ? static_cast<T*>(link) : NULLPTR;
+    }
+
+    /**
+     * @brief Copy constructor.
+     *
+     * @param obj Reference to a source object.
+     */
+    IntrusiveList(const IntrusiveList& obj);
+
+    /**
+     * @brief Copy assignment operator.
+     *
+     * @param obj Reference to a source object.
+     * @return Reference to this object.
+     */
+    IntrusiveList& operator=(const IntrusiveList& obj);
+
+    /**
+     * @brief Root link which is linked to the last and the first elements.
+     */
+    Link root_;
+
+    /**
+     * @brief Number of elements.
+     */
+    int32_t length_;
+
+};
+
+} // namespace eoos
+#endif // INTRUSIVE_LIST_HPP_
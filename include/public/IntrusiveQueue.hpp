@@ -0,0 +1,139 @@
+/**
+ * @file      IntrusiveQueue.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef INTRUSIVE_QUEUE_HPP_
+#define INTRUSIVE_QUEUE_HPP_
+
+#include "IntrusiveList.hpp"
+
+namespace eoos
+{
+
+/**
+ * @class IntrusiveQueue<T,K>
+ * @brief FIFO queue of elements which embed their links.
+ *
+ * The queue has the same properties as IntrusiveList<T,K>, and also allows
+ * an element to leave the queue before its turn, for example on a timeout of waiting.
+ *
+ * @tparam T Data type of queue element derived from IntrusiveLink<K>.
+ * @tparam K Tag type of the link of elements used by the queue.
+ */
+template <typename T, class K = void>
+class IntrusiveQueue
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    IntrusiveQueue() :
+        list_ (){
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~IntrusiveQueue()
+    {
+    }
+
+    /**
+     * @brief Returns a number of elements in this queue.
+     *
+     * @return Number of elements.
+     */
+    int32_t getLength() const
+    {
+        return list_.getLength();
+    }
+
+    /**
+     * @brief Tests if this queue has elements.
+     *
+     * @return True if this queue does not contain any elements.
+     */
+    bool_t isEmpty() const
+    {
+        return list_.isEmpty();
+    }
+
+    /**
+     * @brief Inserts an element to the tail of this queue.
+     *
+     * @param element An element which is not linked.
+     * @return True if the element is inserted.
+     */
+    bool_t add(T& element)
+    {
+        return list_.addLast(element);
+    }
+
+    /**
+     * @brief Removes the head element of this queue.
+     *
+     * @return The removed element, or NULLPTR if this queue is empty.
+     */
+    T* remove()
+    {
+        return list_.removeFirst();
+    }
+
+    /**
+     * @brief Removes an element from this queue.
+     *
+     * @param element An element of this queue.
+     * @return True if the element is removed, or false if the element is not of this queue.
+     */
+    bool_t remove(T& element)
+    {
+        return list_.remove(element);
+    }
+
+    /**
+     * @brief Removes all elements from this queue.
+     */
+    void clear()
+    {
+        list_.clear();
+    }
+
+    /**
+     * @brief Examines the head element of this queue.
+     *
+     * @return The head element, or NULLPTR if this queue is empty.
+     */
+    T* peek() const
+    {
+        return list_.getFirst();
+    }
+
+private:
+
+    /**
+     * @brief Copy constructor.
+     *
+     * @param obj Reference to a source object.
+     */
+    IntrusiveQueue(const IntrusiveQueue& obj);
+
+    /**
+     * @brief Copy assignment operator.
+     *
+     * @param obj Reference to a source object.
+     * @return Reference to this object.
+     */
+    IntrusiveQueue& operator=(const IntrusiveQueue& obj);
+
+    /**
+     * @brief List of elements.
+     */
+    IntrusiveList<T,K> list_;
+
+};
+
+} // namespace eoos
+#endif // INTRUSIVE_QUEUE_HPP_
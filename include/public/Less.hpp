@@ -0,0 +1,40 @@
+/**
+ * @file      Less.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef LESS_HPP_
+#define LESS_HPP_
+
+#include "Types.hpp"
+
+namespace eoos
+{
+
+/**
+ * @struct Less<T>
+ * @brief Comparison function of ordered elements.
+ *
+ * The template compares elements by the less operator, and other orders
+ * are given by classes with the same static function.
+ *
+ * @tparam T Data type of element.
+ */
+template <typename T>
+struct Less
+{
+    /**
+     * @brief Tests if an element precedes another element.
+     *
+     * @param obj1 An element.
+     * @param obj2 Another element.
+     * @return True if the first element precedes the second.
+     */
+    static bool_t isLess(const T& obj1, const T& obj2)
+    {
+        return obj1 < obj2;
+    }
+};
+
+} // namespace eoos
+#endif // LESS_HPP_
@@ -0,0 +1,442 @@
+/**
+ * @file      ListFacade.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef LIST_FACADE_HPP_
+#define LIST_FACADE_HPP_
+
+#include "api.List.hpp"
+
+namespace eoos
+{
+    
+/**
+ * @class ListFacade<T,L>
+ * @brief Compile time bound facade of a list.
+ *
+ * The facade calls functions of a given class by qualified names, so the calls
+ * are bound at compile time and might be inlined, instead of being dispatched
+ * through the virtual table. The specialization for the interface calls them virtually.
+ *
+ * @tparam T Data type of list element.
+ * @tparam L A list class implementing the api::List<T> interface.
+ */
+template <typename T, class L = api::List<T> >
+class ListFacade
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param object An object to call functions of.
+     */
+    explicit ListFacade(L& object) :
+        object_ (object){
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~ListFacade()
+    {
+    }
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const
+    {
+        return object_.L::isConstructed();
+    }
+
+    /**
+     * @copydoc eoos::api::Collection::getLength()
+     */
+    int32_t getLength() const
+    {
+        return object_.L::getLength();
+    }
+
+    /**
+     * @copydoc eoos::api::Collection::isEmpty()
+     */
+    bool_t isEmpty() const
+    {
+        return object_.L::isEmpty();
+    }
+
+    /**
+     * @copydoc eoos::api::List::add(const T&)
+     */
+    bool_t add(const T& element)
+    {
+        return object_.L::add(element);
+    }
+
+    /**
+     * @copydoc eoos::api::List::add(int32_t,const T&)
+     */
+    bool_t add(int32_t const index, const T& element)
+    {
+        return object_.L::add(index, element);
+    }
+
+    #if EOOS_CPP_STANDARD >= 2011
+
+    /**
+     * @copydoc eoos::api::List::add(T&&)
+     */
+    bool_t add(T&& element)
+    {
+        return object_.L::add(static_cast<T&&>(element));
+    }
+
+    /**
+     * @copydoc eoos::api::List::add(int32_t,T&&)
+     */
+    bool_t add(int32_t const index, T&& element)
+    {
+        return object_.L::add(index, static_cast<T&&>(element));
+    }
+
+    /**
+     * @copydoc eoos::api::List::emplace(Args&&...)
+     */
+    template <typename... Args>
+    bool_t emplace(Args&&... args)
+    {
+        T element(static_cast<Args&&>(args)...);
+        return object_.L::add(static_cast<T&&>(element));
+    }
+
+    #endif // EOOS_CPP_STANDARD >= 2011
+
+    /**
+     * @copydoc eoos::api::List::clear()
+     */
+    void clear()
+    {
+        object_.L::clear();
+    }
+
+    /**
+     * @copydoc eoos::api::List::remove(int32_t)
+     */
+    bool_t remove(int32_t const index)
+    {
+        return object_.L::remove(index);
+    }
+
+    /**
+     * @copydoc eoos::api::List::removeFirst()
+     */
+    bool_t removeFirst()
+    {
+        return object_.L::removeFirst();
+    }
+
+    /**
+     * @copydoc eoos::api::List::removeLast()
+     */
+    bool_t removeLast()
+    {
+        return object_.L::removeLast();
+    }
+
+    /**
+     * @copydoc eoos::api::List::removeElement(const T&)
+     */
+    bool_t removeElement(const T& element)
+    {
+        return object_.L::removeElement(element);
+    }
+
+    /**
+     * @copydoc eoos::api::List::get(int32_t)
+     */
+    T& get(int32_t const index) const
+    {
+        return object_.L::get(index);
+    }
+
+    /**
+     * @copydoc eoos::api::List::getFirst()
+     */
+    T& getFirst() const
+    {
+        return object_.L::getFirst();
+    }
+
+    /**
+     * @copydoc eoos::api::List::getLast()
+     */
+    T& getLast() const
+    {
+        return object_.L::getLast();
+    }
+
+    /**
+     * @copydoc eoos::api::List::getIndexOf(const T&)
+     */
+    int32_t getIndexOf(const T& element) const
+    {
+        return object_.L::getIndexOf(element);
+    }
+
+    /**
+     * @copydoc eoos::api::List::isIndex(int32_t)
+     */
+    bool_t isIndex(int32_t const index) const
+    {
+        return object_.L::isIndex(index);
+    }
+
+    /**
+     * @copydoc eoos::api::List::addAll(const T*,int32_t)
+     */
+    bool_t addAll(const T* const elements, int32_t const number)
+    {
+        return object_.L::addAll(elements, number);
+    }
+
+    /**
+     * @copydoc eoos::api::List::removeRange(int32_t,int32_t)
+     */
+    bool_t removeRange(int32_t const from, int32_t const to)
+    {
+        return object_.L::removeRange(from, to);
+    }
+
+    /**
+     * @copydoc eoos::api::List::copyTo(T*,int32_t)
+     */
+    int32_t copyTo(T* const elements, int32_t const number) const
+    {
+        return object_.L::copyTo(elements, number);
+    }
+
+private:
+
+    /**
+     * @brief The object functions are called of.
+     */
+    L& object_;
+
+};
+
+/**
+ * @class ListFacade<T,api::List<T> >
+ * @brief Virtual facade of a list.
+ *
+ * The specialization calls functions of the interface virtually.
+ */
+template <typename T>
+class ListFacade<T,api::List<T> >
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param object An object to call functions of.
+     */
+    explicit ListFacade(api::List<T>& object) :
+        object_ (object){
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~ListFacade()
+    {
+    }
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const
+    {
+        return object_.isConstructed();
+    }
+
+    /**
+     * @copydoc eoos::api::Collection::getLength()
+     */
+    int32_t getLength() const
+    {
+        return object_.getLength();
+    }
+
+    /**
+     * @copydoc eoos::api::Collection::isEmpty()
+     */
+    bool_t isEmpty() const
+    {
+        return object_.isEmpty();
+    }
+
+    /**
+     * @copydoc eoos::api::List::add(const T&)
+     */
+    bool_t add(const T& element)
+    {
+        return object_.add(element);
+    }
+
+    /**
+     * @copydoc eoos::api::List::add(int32_t,const T&)
+     */
+    bool_t add(int32_t const index, const T& element)
+    {
+        return object_.add(index, element);
+    }
+
+    #if EOOS_CPP_STANDARD >= 2011
+
+    /**
+     * @copydoc eoos::api::List::add(T&&)
+     */
+    bool_t add(T&& element)
+    {
+        return object_.add(static_cast<T&&>(element));
+    }
+
+    /**
+     * @copydoc eoos::api::List::add(int32_t,T&&)
+     */
+    bool_t add(int32_t const index, T&& element)
+    {
+        return object_.add(index, static_cast<T&&>(element));
+    }
+
+    /**
+     * @copydoc eoos::api::List::emplace(Args&&...)
+     */
+    template <typename... Args>
+    bool_t emplace(Args&&... args)
+    {
+        T element(static_cast<Args&&>(args)...);
+        return object_.add(static_cast<T&&>(element));
+    }
+
+    #endif // EOOS_CPP_STANDARD >= 2011
+
+    /**
+     * @copydoc eoos::api::List::clear()
+     */
+    void clear()
+    {
+        object_.clear();
+    }
+
+    /**
+     * @copydoc eoos::api::List::remove(int32_t)
+     */
+    bool_t remove(int32_t const index)
+    {
+        return object_.remove(index);
+    }
+
+    /**
+     * @copydoc eoos::api::List::removeFirst()
+     */
+    bool_t removeFirst()
+    {
+        return object_.removeFirst();
+    }
+
+    /**
+     * @copydoc eoos::api::List::removeLast()
+     */
+    bool_t removeLast()
+    {
+        return object_.removeLast();
+    }
+
+    /**
+     * @copydoc eoos::api::List::removeElement(const T&)
+     */
+    bool_t removeElement(const T& element)
+    {
+        return object_.removeElement(element);
+    }
+
+    /**
+     * @copydoc eoos::api::List::get(int32_t)
+     */
+    T& get(int32_t const index) const
+    {
+        return object_.get(index);
+    }
+
+    /**
+     * @copydoc eoos::api::List::getFirst()
+     */
+    T& getFirst() const
+    {
+        return object_.getFirst();
+    }
+
+    /**
+     * @copydoc eoos::api::List::getLast()
+     */
+    T& getLast() const
+    {
+        return object_.getLast();
+    }
+
+    /**
+     * @copydoc eoos::api::List::getIndexOf(const T&)
+     */
+    int32_t getIndexOf(const T& element) const
+    {
+        return object_.getIndexOf(element);
+    }
+
+    /**
+     * @copydoc eoos::api::List::isIndex(int32_t)
+     */
+    bool_t isIndex(int32_t const index) const
+    {
+        return object_.isIndex(index);
+    }
+
+    /**
+     * @copydoc eoos::api::List::addAll(const T*,int32_t)
+     */
+    bool_t addAll(const T* const elements, int32_t const number)
+    {
+        return object_.addAll(elements, number);
+    }
+
+    /**
+     * @copydoc eoos::api::List::removeRange(int32_t,int32_t)
+     */
+    bool_t removeRange(int32_t const from, int32_t const to)
+    {
+        return object_.removeRange(from, to);
+    }
+
+    /**
+     * @copydoc eoos::api::List::copyTo(T*,int32_t)
+     */
+    int32_t copyTo(T* const elements, int32_t const number) const
+    {
+        return object_.copyTo(elements, number);
+    }
+
+private:
+
+    /**
+     * @brief The object functions are called of.
+     */
+    api::List<T>& object_;
+
+};
+
+} // namespace eoos
+#endif // LIST_FACADE_HPP_
@@ -0,0 +1,380 @@
+/**
+ * @file      LockFreeStack.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef LOCK_FREE_STACK_HPP_
+#define LOCK_FREE_STACK_HPP_
+
+#include "Object.hpp"
+#include "api.Collection.hpp"
+
+#if EOOS_CPP_STANDARD >= 2011
+
+#include <atomic>
+
+namespace eoos
+{
+
+/**
+ * @class LockFreeStack<T,L,A>
+ * @brief Lock-free LIFO stack of static capacity.
+ *
+ * The stack keeps elements in an array embedded into the stack object, and links
+ * them into two Treiber stacks: the stack of elements and the stack of free slots.
+ * A head of a linked stack is a slot index tagged with a counter of head changes in
+ * one atomic word, so a thread which has been preempted between reading a head and
+ * replacing it fails the replacement even if the same slot has returned to the head.
+ * The index takes as few bits as L needs, and the tag takes all other bits of the word,
+ * which is 64-bit if such atomics are lock-free, or 32-bit otherwise. Thus on 32-bit
+ * processors the tag repeats after 2^(32 - INDEX_BITS) changes, that is 2^24 for 255 elements.
+ * Batches of elements are pushed and popped by one replacement of a head.
+ *
+ * As elements are copied in and out of the stack, the stack might be a free list
+ * of pointers to blocks of an object pool.
+ *
+ * @note Data type of elements must be default constructible and copy assignable.
+ *
+ * @tparam T Data type of stack element.
+ * @tparam L Maximum number of elements.
+ * @tparam A Heap memory allocator class.
+ */
+template <typename T, int32_t L, class A = Allocator>
+class LockFreeStack : public Object<A>, public api::Collection<T>
+{
+    typedef Object<A> Parent;
+
+    /**
+     * @struct Bits<N,IS_ZERO>
+     * @brief Number of bits of a number.
+     *
+     * @tparam N       A number.
+     * @tparam IS_ZERO The number is zero.
+     */
+    template <int32_t N, bool_t IS_ZERO = (N == 0)>
+    struct Bits
+    {
+        static const int32_t VALUE = 1 + Bits<(N >> 1)>::VALUE;
+    };
+
+    /**
+     * @struct Bits<N,true>
+     * @brief Number of bits of zero.
+     *
+     * @tparam N A number.
+     */
+    template <int32_t N>
+    struct Bits<N, true>
+    {
+        static const int32_t VALUE = 0;
+    };
+
+    /**
+     * @brief Head of a linked stack of a slot index and a tag.
+     */
+    #if ATOMIC_LLONG_LOCK_FREE == 2
+    typedef uint64_t Head;
+    #else
+    typedef uint32_t Head;
+    #endif
+
+    /**
+     * @brief Number of bits of a slot index, which value of all bits set is -1.
+     */
+    static const int32_t INDEX_BITS = Bits<L>::VALUE;
+
+    static_assert(L > 0, "Maximum number of elements must be positive");
+    static_assert(static_cast<int32_t>(sizeof(Head)) * 8 - INDEX_BITS >= 16, "Head tag must have 16 bits at least");
+    static_assert(ATOMIC_INT_LOCK_FREE == 2, "Atomic words must be lock-free");
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    LockFreeStack() : Parent(),
+        elements_ (),
+        links_    (),
+        used_     (EMPTY),
+        free_     (EMPTY),
+        length_   (0){
+        for(int32_t i = 0; i < L; i++)
+        {
+            links_[i].store(i + 1, std::memory_order_relaxed);
+        }
+        if(L > 0)
+        {
+            links_[L - 1].store(-1, std::memory_order_relaxed);
+            free_.store(0, std::memory_order_relaxed);
+        }
+        this->setConstructed( L > 0 );
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~LockFreeStack()
+    {
+    }
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const
+    {
+        return Parent::isConstructed();
+    }
+
+    /**
+     * @copydoc eoos::api::Collection::getLength()
+     *
+     * @note The length might be changed by other threads right after it is returned,
+     * and it counts elements being pushed before they are available to be popped.
+     */
+    virtual int32_t getLength() const
+    {
+        return length_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @copydoc eoos::api::Collection::isEmpty()
+     */
+    virtual bool_t isEmpty() const
+    {
+        return getIndex( used_.load(std::memory_order_acquire) ) < 0;
+    }
+
+    /**
+     * @brief Inserts a new element to the top of this stack.
+     *
+     * @param element An inserting element.
+     * @return True if element is added.
+     */
+    bool_t push(const T& element)
+    {
+        return push(&element, 1) == 1;
+    }
+
+    /**
+     * @brief Inserts new elements to the top of this stack.
+     *
+     * The last element of the array becomes the top.
+     *
+     * @param elements An array of inserting elements.
+     * @param number   A number of elements of the array.
+     * @return Number of added elements from the beginning of the array, or -1 if an error has been occurred.
+     */
+    int32_t push(const T* const elements, int32_t const number)
+    {
+        int32_t res = -1;
+        if( isConstructed() && (elements != NULLPTR) && (number >= 0) )
+        {
+            int32_t last = -1;
+            int32_t const first = unlink(free_, number, last, res);
+            if(res > 0)
+            {
+                // Fill the chain from its last slot, so the last element is the top
+                int32_t index = first;
+                for(int32_t i = res - 1; i >= 0; i--)
+                {
+                    elements_[index] = elements[i];
+                    index = links_[index].load(std::memory_order_relaxed);
+                }
+                // Count the elements before they might be popped, so the length is never negative
+                static_cast<void>( length_.fetch_add(res, std::memory_order_relaxed) );
+                link(used_, first, last);
+            }
+        }
+        return res;
+    }
+
+    /**
+     * @brief Removes the top element of this stack.
+     *
+     * @param element A variable the removed element is copied to.
+     * @return True if an element is removed successfully.
+     */
+    bool_t pop(T& element)
+    {
+        return pop(&element, 1) == 1;
+    }
+
+    /**
+     * @brief Removes elements from the top of this stack.
+     *
+     * The top element is copied to the beginning of the array.
+     *
+     * @param elements An array to copy removed elements to.
+     * @param number   A number of elements of the array.
+     * @return Number of removed elements, or -1 if an error has been occurred.
+     */
+    int32_t pop(T* const elements, int32_t const number)
+    {
+        int32_t res = -1;
+        if( isConstructed() && (elements != NULLPTR) && (number >= 0) )
+        {
+            int32_t last = -1;
+            int32_t const first = unlink(used_, number, last, res);
+            if(res > 0)
+            {
+                static_cast<void>( length_.fetch_sub(res, std::memory_order_relaxed) );
+                int32_t index = first;
+                for(int32_t i = 0; i < res; i++)
+                {
+                    elements[i] = elements_[index];
+                    elements_[index] = T();
+                    index = links_[index].load(std::memory_order_relaxed);
+                }
+                link(free_, first, last);
+            }
+        }
+        return res;
+    }
+
+private:
+
+    /**
+     * @brief Mask of a slot index of a head.
+     */
+    static const Head INDEX_MASK = (static_cast<Head>(1) << INDEX_BITS) - 1U;
+
+    /**
+     * @brief Head of an empty linked stack, which index is -1 and tag is 0.
+     */
+    static const Head EMPTY = INDEX_MASK;
+
+    /**
+     * @brief Returns a slot index of a head.
+     *
+     * @param head A head.
+     * @return The index, or -1 if the linked stack is empty.
+     */
+    static int32_t getIndex(Head const head)
+    {
+        Head const index = head & INDEX_MASK;
+        return (index == INDEX_MASK) ? -1 : static_cast<int32_t>(index);
+    }
+
+    /**
+     * @brief Returns a head of a slot index and a tag of next head of a head.
+     *
+     * @param head  A previous head.
+     * @param index A slot index, or -1.
+     * @return The head.
+     */
+    static Head getHead(Head const head, int32_t const index)
+    {
+        // The tag overflow is shifted out of the word
+        Head const tag = (head >> INDEX_BITS) + 1U;
+        return (tag << INDEX_BITS) | ( static_cast<Head>( static_cast<uint32_t>(index) ) & INDEX_MASK );
+    }
+
+    /**
+     * @brief Unlinks slots from the top of a linked stack.
+     *
+     * @param head   A head of the linked stack.
+     * @param number A maximum number of slots.
+     * @param last   A variable the last unlinked slot is written to.
+     * @param length A variable the number of unlinked slots is written to.
+     * @return The first unlinked slot, or -1 if no slots are unlinked.
+     */
+    int32_t unlink(std::atomic<Head>& head, int32_t const number, int32_t& last, int32_t& length)
+    {
+        int32_t first = -1;
+        length = 0;
+        if(number > 0)
+        {
+            Head top = head.load(std::memory_order_acquire);
+            while(true)
+            {
+                first = getIndex(top);
+                length = 0;
+                if(first < 0)
+                {
+                    break;
+                }
+                // The links might be changed by other threads, but then the head tag is changed too
+                last = first;
+                length = 1;
+                int32_t next = links_[last].load(std::memory_order_relaxed);
+                while( (length < number) && (next >= 0) )
+                {
+                    last = next;
+                    length++;
+                    next = links_[last].load(std::memory_order_relaxed);
+                }
+                if( head.compare_exchange_weak(top, getHead(top, next), std::memory_order_acq_rel, std::memory_order_acquire) )
+                {
+                    break;
+                }
+            }
+        }
+        return first;
+    }
+
+    /**
+     * @brief Links a chain of slots to the top of a linked stack.
+     *
+     * @param head  A head of the linked stack.
+     * @param first The first slot of the chain.
+     * @param last  The last slot of the chain.
+     */
+    void link(std::atomic<Head>& head, int32_t const first, int32_t const last)
+    {
+        Head top = head.load(std::memory_order_relaxed);
+        while(true)
+        {
+            links_[last].store(getIndex(top), std::memory_order_relaxed);
+            if( head.compare_exchange_weak(top, getHead(top, first), std::memory_order_acq_rel, std::memory_order_relaxed) )
+            {
+                break;
+            }
+        }
+    }
+
+    /**
+     * @brief Copy constructor.
+     *
+     * @param obj Reference to a source object.
+     */
+    LockFreeStack(const LockFreeStack& obj);
+
+    /**
+     * @brief Copy assignment operator.
+     *
+     * @param obj Reference to a source object.
+     * @return Reference to this object.
+     */
+    LockFreeStack& operator=(const LockFreeStack& obj);
+
+    /**
+     * @brief Array of elements.
+     */
+    T elements_[L];
+
+    /**
+     * @brief Array of indexes of next slots of slots, or -1 for the last slots.
+     */
+    std::atomic<int32_t> links_[L];
+
+    /**
+     * @brief Head of the linked stack of elements.
+     */
+    std::atomic<Head> used_;
+
+    /**
+     * @brief Head of the linked stack of free slots.
+     */
+    std::atomic<Head> free_;
+
+    /**
+     * @brief Number of elements.
+     */
+    std::atomic<int32_t> length_;
+
+};
+
+} // namespace eoos
+
+#endif // EOOS_CPP_STANDARD >= 2011
+#endif // LOCK_FREE_STACK_HPP_
@@ -0,0 +1,189 @@
+/**
+ * @file      MutexFacade.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef MUTEX_FACADE_HPP_
+#define MUTEX_FACADE_HPP_
+
+#include "api.Mutex.hpp"
+
+namespace eoos
+{
+    
+/**
+ * @class MutexFacade<M>
+ * @brief Compile time bound facade of a mutex.
+ *
+ * The facade calls functions of a given class by qualified names, so the calls
+ * are bound at compile time and might be inlined, instead of being dispatched
+ * through the virtual table. The specialization for the interface calls them virtually.
+ *
+ * @tparam M A mutex class implementing the api::Mutex interface.
+ */
+template <class M = api::Mutex>
+class MutexFacade
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param object An object to call functions of.
+     */
+    explicit MutexFacade(M& object) :
+        object_ (object){
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~MutexFacade()
+    {
+    }
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const
+    {
+        return object_.M::isConstructed();
+    }
+
+    /**
+     * @copydoc eoos::api::Mutex::tryLock()
+     */
+    bool_t tryLock()
+    {
+        return object_.M::tryLock();
+    }
+
+    /**
+     * @copydoc eoos::api::Mutex::lock()
+     */
+    bool_t lock()
+    {
+        return object_.M::lock();
+    }
+
+    /**
+     * @copydoc eoos::api::Mutex::unlock()
+     */
+    void unlock()
+    {
+        object_.M::unlock();
+    }
+
+    /**
+     * @copydoc eoos::api::Mutex::getProtocol()
+     */
+    api::Mutex::Protocol getProtocol() const
+    {
+        return object_.M::getProtocol();
+    }
+
+    /**
+     * @copydoc eoos::api::Mutex::getCeiling()
+     */
+    int32_t getCeiling() const
+    {
+        return object_.M::getCeiling();
+    }
+
+private:
+
+    /**
+     * @brief The object functions are called of.
+     */
+    M& object_;
+
+};
+
+/**
+ * @class MutexFacade<api::Mutex>
+ * @brief Virtual facade of a mutex.
+ *
+ * The specialization calls functions of the interface virtually.
+ */
+template <>
+class MutexFacade<api::Mutex>
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param object An object to call functions of.
+     */
+    explicit MutexFacade(api::Mutex& object) :
+        object_ (object){
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~MutexFacade()
+    {
+    }
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const
+    {
+        return object_.isConstructed();
+    }
+
+    /**
+     * @copydoc eoos::api::Mutex::tryLock()
+     */
+    bool_t tryLock()
+    {
+        return object_.tryLock();
+    }
+
+    /**
+     * @copydoc eoos::api::Mutex::lock()
+     */
+    bool_t lock()
+    {
+        return object_.lock();
+    }
+
+    /**
+     * @copydoc eoos::api::Mutex::unlock()
+     */
+    void unlock()
+    {
+        object_.unlock();
+    }
+
+    /**
+     * @copydoc eoos::api::Mutex::getProtocol()
+     */
+    api::Mutex::Protocol getProtocol() const
+    {
+        return object_.getProtocol();
+    }
+
+    /**
+     * @copydoc eoos::api::Mutex::getCeiling()
+     */
+    int32_t getCeiling() const
+    {
+        return object_.getCeiling();
+    }
+
+private:
+
+    /**
+     * @brief The object functions are called of.
+     */
+    api::Mutex& object_;
+
+};
+
+} // namespace eoos
+#endif // MUTEX_FACADE_HPP_
@@ -68,6 +68,20 @@ public:
     
 protected:
 
+    #if EOOS_CPP_STANDARD >= 2011
+
+    /**
+     * @brief Constructor.
+     */
+    ObjectAllocator() = default;
+
+    /**
+     * @brief Destructor.
+     */
+    ~ObjectAllocator() = default;
+
+    #else
+
     /**
      * @brief Constructor.
      */
@@ -82,6 +96,8 @@ protected:
     {
     }    
 
+    #endif // EOOS_CPP_STANDARD >= 2011
+
 };
 
 } // namespace eoos
@@ -0,0 +1,145 @@
+/**
+ * @file      OutStreamFormat.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Output operators of numbers to output streams.
+ *
+ * A number is formatted by Formatter on the stack and output to a stream by its
+ * length, so the operators work for any stream implementation, and a stream
+ * overriding its operator of strings does not hide them. The operators are
+ * declared in the namespace of the stream interface to be found by argument
+ * dependent lookup.
+ *
+ * @note The literal 0 is also a null pointer constant, so it is ambiguous if it is
+ * written to an object of a stream class, and it should be written through api::OutStream.
+ */
+#ifndef OUT_STREAM_FORMAT_HPP_
+#define OUT_STREAM_FORMAT_HPP_
+
+#include "api.OutStream.hpp"
+#include "Formatter.hpp"
+
+namespace eoos
+{
+namespace api
+{
+
+/**
+ * @brief Writes formatted characters to an output stream.
+ *
+ * @param stream An output stream.
+ * @param source A source array of characters.
+ * @param length Number of characters of the array.
+ * @return The output stream.
+ */
+template <typename T>
+inline OutStream<T>& outputFormatted(OutStream<T>& stream, const char_t* const source, int32_t const length)
+{
+    T string[Formatter::LENGTH_MAX];
+    for(int32_t i = 0; i < length; i++)
+    {
+        string[i] = static_cast<T>(source[i]);
+    }
+    return stream.write(string, length);
+}
+
+/**
+ * @copydoc eoos::api::outputFormatted(OutStream<T>&,const char_t*,int32_t)
+ */
+template <>
+inline OutStream<char_t>& outputFormatted(OutStream<char_t>& stream, const char_t* const source, int32_t const length)
+{
+    return stream.write(source, length);
+}
+
+/**
+ * @brief Writes a number to an output stream.
+ *
+ * Integers are taken by the standard types, which are distinct types for any data
+ * model unlike fixed width types, so any integer argument has an exact overload.
+ *
+ * @param stream An output stream.
+ * @param value  A number to be output.
+ * @return The output stream.
+ */
+template <typename T>
+inline OutStream<T>& operator<<(OutStream<T>& stream, signed int const value)
+{
+    char_t buffer[Formatter::LENGTH_MAX];
+    return outputFormatted(stream, buffer, Formatter::format(static_cast<int64_t>(value), buffer));
+}
+
+/**
+ * @copydoc eoos::api::operator<<(OutStream<T>&,signed int)
+ */
+template <typename T>
+inline OutStream<T>& operator<<(OutStream<T>& stream, unsigned int const value)
+{
+    char_t buffer[Formatter::LENGTH_MAX];
+    return outputFormatted(stream, buffer, Formatter::format(static_cast<uint64_t>(value), buffer));
+}
+
+/**
+ * @copydoc eoos::api::operator<<(OutStream<T>&,signed int)
+ */
+template <typename T>
+inline OutStream<T>& operator<<(OutStream<T>& stream, signed long const value)
+{
+    char_t buffer[Formatter::LENGTH_MAX];
+    return outputFormatted(stream, buffer, Formatter::format(static_cast<int64_t>(value), buffer));
+}
+
+/**
+ * @copydoc eoos::api::operator<<(OutStream<T>&,signed int)
+ */
+template <typename T>
+inline OutStream<T>& operator<<(OutStream<T>& stream, unsigned long const value)
+{
+    char_t buffer[Formatter::LENGTH_MAX];
+    return outputFormatted(stream, buffer, Formatter::format(static_cast<uint64_t>(value), buffer));
+}
+
+/**
+ * @copydoc eoos::api::operator<<(OutStream<T>&,signed int)
+ */
+template <typename T>
+inline OutStream<T>& operator<<(OutStream<T>& stream, signed long long const value)
+{
+    char_t buffer[Formatter::LENGTH_MAX];
+    return outputFormatted(stream, buffer, Formatter::format(static_cast<int64_t>(value), buffer));
+}
+
+/**
+ * @copydoc eoos::api::operator<<(OutStream<T>&,signed int)
+ */
+template <typename T>
+inline OutStream<T>& operator<<(OutStream<T>& stream, unsigned long long const value)
+{
+    char_t buffer[Formatter::LENGTH_MAX];
+    return outputFormatted(stream, buffer, Formatter::format(static_cast<uint64_t>(value), buffer));
+}
+
+/**
+ * @copydoc eoos::api::operator<<(OutStream<T>&,signed int)
+ */
+template <typename T>
+inline OutStream<T>& operator<<(OutStream<T>& stream, float32_t const value)
+{
+    char_t buffer[Formatter::LENGTH_MAX];
+    return outputFormatted(stream, buffer, Formatter::format(value, buffer));
+}
+
+/**
+ * @copydoc eoos::api::operator<<(OutStream<T>&,signed int)
+ */
+template <typename T>
+inline OutStream<T>& operator<<(OutStream<T>& stream, float64_t const value)
+{
+    char_t buffer[Formatter::LENGTH_MAX];
+    return outputFormatted(stream, buffer, Formatter::format(value, buffer));
+}
+
+} // namespace api
+} // namespace eoos
+#endif // OUT_STREAM_FORMAT_HPP_
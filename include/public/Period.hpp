@@ -0,0 +1,132 @@
+/**
+ * @file      Period.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PERIOD_HPP_
+#define PERIOD_HPP_
+
+#include "Object.hpp"
+#include "api.System.hpp"
+
+namespace eoos
+{
+    
+/**
+ * @class Period<A>
+ * @brief Drift-free periodic sleep.
+ *
+ * The class counts releases of a periodic loop from the absolute start time,
+ * so that the time of executing the loop body does not shift next releases.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A = Allocator>
+class Period : public Object<A>
+{
+    typedef Object<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * The first release is at the moment of the object creation.
+     *
+     * @param system The operating system interface.
+     * @param period A period in nanoseconds.
+     */
+    Period(api::System& system, int64_t const period) : Parent(),
+        system_  (system),
+        period_  (period),
+        release_ (system.getTime()),
+        overruns_(0){
+        if( period_ <= 0 )
+        {
+            Parent::setConstructed(false);
+        }
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Period()
+    {
+    }
+
+    /**
+     * @brief Causes current thread to sleep until the next release.
+     *
+     * If the next release has already passed, the missed releases are skipped,
+     * counted as overruns, and current thread sleeps until the first future release.
+     *
+     * @return True if no releases have been missed, or false if releases have been missed
+     *         and counted as overruns, or if an error has been occurred.
+     */
+    bool_t wait()
+    {
+        bool_t res = false;
+        if( Parent::isConstructed() )
+        {
+            res = true;
+            release_ += period_;
+            int64_t const time = system_.getTime();
+            if( release_ < time )
+            {
+                // A release at the current time is not missed
+                int64_t const missed = (time - release_ + period_ - 1) / period_;
+                release_ += missed * period_;
+                overruns_ += missed;
+                res = false;
+            }
+            system_.getScheduler().sleepUntil(release_);
+        }
+        return res;
+    }
+
+    /**
+     * @brief Returns time of the last release.
+     *
+     * @return Time in nanoseconds of the system running time.
+     */
+    int64_t getRelease() const
+    {
+        return release_;
+    }
+
+    /**
+     * @brief Returns a number of missed releases.
+     *
+     * @return Number of releases skipped because the loop body had been executed longer than the period.
+     */
+    int64_t getOverruns() const
+    {
+        return overruns_;
+    }
+
+private:
+
+    /**
+     * @brief The operating system interface.
+     */
+    api::System& system_;
+
+    /**
+     * @brief Period in nanoseconds.
+     */
+    int64_t period_;
+
+    /**
+     * @brief Absolute time of the last release in nanoseconds.
+     */
+    int64_t release_;
+
+    /**
+     * @brief Number of missed releases.
+     */
+    int64_t overruns_;
+
+};
+  
+} // namespace eoos
+#endif // PERIOD_HPP_
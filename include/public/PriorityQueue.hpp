@@ -0,0 +1,619 @@
+/**
+ * @file      PriorityQueue.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef PRIORITY_QUEUE_HPP_
+#define PRIORITY_QUEUE_HPP_
+
+#include "Object.hpp"
+#include "Less.hpp"
+#include "api.Queue.hpp"
+
+namespace eoos
+{
+
+#ifdef EOOS_NO_STRICT_MISRA_RULES
+
+/**
+ * @class PriorityQueue<T,C,A>
+ * @brief Queue which head is the least element.
+ *
+ * The queue is a 4-ary heap in one array, so a parent and its children are close
+ * in memory, and the heap is half as high as a binary heap. An element might be
+ * inserted with a handle, which allows to change or to remove the element later,
+ * for example to reschedule or to cancel a timer. A handle is valid until its
+ * element is removed, and then it might be given to another element.
+ *
+ * @note Data type of elements must be default constructible and copy assignable.
+ *
+ * @tparam T Data type of queue element.
+ * @tparam C Comparison function class of elements.
+ * @tparam A Heap memory allocator class.
+ */
+template <typename T, class C = Less<T>, class A = Allocator>
+class PriorityQueue : public Object<A>, public api::Queue<T>
+{
+    typedef Object<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    PriorityQueue() : Parent(),
+        entries_   (NULLPTR),
+        positions_ (NULLPTR),
+        capacity_  (0),
+        length_    (0),
+        illegal_   (){
+        bool_t const isConstructed = construct(CAPACITY_MIN);
+        this->setConstructed( isConstructed );
+    }
+
+    /**
+     * @brief Constructor.
+     *
+     * @param illegal An illegal value.
+     */
+    explicit PriorityQueue(const T& illegal) : Parent(),
+        entries_   (NULLPTR),
+        positions_ (NULLPTR),
+        capacity_  (0),
+        length_    (0),
+        illegal_   (illegal){
+        bool_t const isConstructed = construct(CAPACITY_MIN);
+        this->setConstructed( isConstructed );
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~PriorityQueue()
+    {
+        destruct(entries_, positions_, capacity_);
+    }
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const
+    {
+        return Parent::isConstructed();
+    }
+
+    /**
+     * @copydoc eoos::api::Collection::getLength()
+     */
+    virtual int32_t getLength() const
+    {
+        return length_;
+    }
+
+    /**
+     * @copydoc eoos::api::Collection::isEmpty()
+     */
+    virtual bool_t isEmpty() const
+    {
+        return length_ == 0;
+    }
+
+    /**
+     * @copydoc eoos::api::Queue::add(const T&)
+     */
+    virtual bool_t add(const T& element)
+    {
+        int32_t handle;
+        return add(element, handle);
+    }
+
+    #if EOOS_CPP_STANDARD >= 2011
+
+    /**
+     * @copydoc eoos::api::Queue::add(T&&)
+     */
+    virtual bool_t add(T&& element)
+    {
+        bool_t res = false;
+        if( isConstructed() && reserve(length_ + 1) )
+        {
+            entries_[length_].element = static_cast<T&&>(element);
+            static_cast<void>( push() );
+            res = true;
+        }
+        return res;
+    }
+
+    #endif // EOOS_CPP_STANDARD >= 2011
+
+    /**
+     * @brief Inserts a new element to this container and returns its handle.
+     *
+     * @param element An inserting element.
+     * @param handle  A variable the handle of the element is written to.
+     * @return True if element is added.
+     */
+    bool_t add(const T& element, int32_t& handle)
+    {
+        bool_t res = false;
+        if( isConstructed() && reserve(length_ + 1) )
+        {
+            entries_[length_].element = element;
+            handle = push();
+            res = true;
+        }
+        return res;
+    }
+
+    /**
+     * @copydoc eoos::api::Queue::addAll(const T*, int32_t)
+     */
+    virtual bool_t addAll(const T* const elements, int32_t const number)
+    {
+        bool_t res = false;
+        if( isConstructed() && (elements != NULLPTR) && (number >= 0) && reserve(length_ + number) )
+        {
+            for(int32_t i = 0; i < number; i++)
+            {
+                entries_[length_].element = elements[i];
+                static_cast<void>( push() );
+            }
+            res = true;
+        }
+        return res;
+    }
+
+    /**
+     * @copydoc eoos::api::Queue::remove()
+     */
+    virtual bool_t remove()
+    {
+        bool_t res = false;
+        if( isConstructed() && (length_ > 0) )
+        {
+            removeAt(0);
+            res = true;
+        }
+        return res;
+    }
+
+    /**
+     * @brief Removes an element of a handle from this container.
+     *
+     * @param handle A handle of an element.
+     * @return True if an element is removed successfully.
+     */
+    bool_t remove(int32_t const handle)
+    {
+        bool_t res = false;
+        if( isConstructed() && isHandle(handle) )
+        {
+            removeAt( positions_[handle] );
+            res = true;
+        }
+        return res;
+    }
+
+    /**
+     * @brief Replaces an element of a handle with another element.
+     *
+     * The element takes its place in this container, so a lesser element
+     * moves to the head, and a greater element moves to the tail.
+     *
+     * @param handle  A handle of an element.
+     * @param element A replacing element.
+     * @return True if the element is replaced.
+     */
+    bool_t update(int32_t const handle, const T& element)
+    {
+        bool_t res = false;
+        if( isConstructed() && isHandle(handle) )
+        {
+            int32_t const index = positions_[handle];
+            bool_t const isDecreased = C::isLess(element, entries_[index].element);
+            entries_[index].element = element;
+            if(isDecreased == true)
+            {
+                siftUp(index);
+            }
+            else
+            {
+                siftDown(index);
+            }
+            res = true;
+        }
+        return res;
+    }
+
+    /**
+     * @brief Removes all elements from this container.
+     */
+    void clear()
+    {
+        if( isConstructed() )
+        {
+            for(int32_t i = 0; i < length_; i++)
+            {
+                entries_[i].element = T();
+                positions_[ entries_[i].handle ] = -1;
+            }
+            length_ = 0;
+        }
+    }
+
+    /**
+     * @copydoc eoos::api::Queue::peek()
+     */
+    virtual T& peek() const
+    {
+        return ( isConstructed() && (length_ > 0) ) ? entries_[0].element : illegal_;
+    }
+
+    /**
+     * @brief Returns an element of a handle.
+     *
+     * @param handle A handle of an element.
+     * @return The element, or illegal element if the handle is not valid.
+     */
+    T& get(int32_t const handle) const
+    {
+        return ( isConstructed() && isHandle(handle) ) ? entries_[ positions_[handle] ].element : illegal_;
+    }
+
+    /**
+     * @copydoc eoos::api::Queue::copyTo(T*, int32_t)
+     *
+     * @note Elements are copied in order of the heap, so only the first copied element is the least.
+     */
+    virtual int32_t copyTo(T* const elements, int32_t const number) const
+    {
+        int32_t res = -1;
+        if( isConstructed() && (elements != NULLPTR) && (number >= 0) )
+        {
+            res = (number < length_) ? number : length_;
+            for(int32_t i = 0; i < res; i++)
+            {
+                elements[i] = entries_[i].element;
+            }
+        }
+        return res;
+    }
+
+    /**
+     * @copydoc eoos::api::IllegalValue::getIllegal()
+     */
+    virtual T& getIllegal() const
+    {
+        return illegal_;
+    }
+
+    /**
+     * @copydoc eoos::api::IllegalValue::setIllegal(const T&)
+     */
+    virtual void setIllegal(const T& value)
+    {
+        illegal_ = value;
+    }
+
+    /**
+     * @copydoc eoos::api::IllegalValue::isIllegal(const T&)
+     */
+    virtual bool_t isIllegal(const T& value) const
+    {
+        return illegal_ == value;
+    }
+
+private:
+
+    /**
+     * @struct Entry
+     * @brief An element and its handle.
+     */
+    struct Entry : public ObjectAllocator<A>
+    {
+        Entry() : ObjectAllocator<A>(),
+            element (),
+            handle  (-1){
+        }
+
+        T element;
+        int32_t handle;
+    };
+
+    /**
+     * @brief Number of children of a heap node.
+     */
+    static const int32_t DEGREE = 4;
+
+    /**
+     * @brief Initial number of entries.
+     */
+    static const int32_t CAPACITY_MIN = 8;
+
+    /**
+     * @brief Maximum number of entries, which keeps indexes of children in range.
+     */
+    static const int32_t CAPACITY_MAX = 0x10000000;
+
+    /**
+     * @brief Allocates and constructs arrays of entries and positions.
+     *
+     * Entries keep all the handles, so handles of entries beyond the length are free.
+     *
+     * @param capacity A number of entries.
+     * @return True if the arrays are allocated.
+     */
+    bool_t construct(int32_t const capacity)
+    {
+        bool_t res = false;
+        void* const entries = A::allocate( sizeof(Entry) * static_cast<size_t>(capacity) );
+        void* const positions = A::allocate( sizeof(int32_t) * static_cast<size_t>(capacity) );
+        if( (entries != NULLPTR) && (positions != NULLPTR) )
+        {
+            entries_ = reinterpret_cast<Entry*>(entries);
+            positions_ = reinterpret_cast<int32_t*>(positions);
+            for(int32_t i = 0; i < capacity; i++)
+            {
+                static_cast<void>( new (&entries_[i]) Entry() );
+                entries_[i].handle = i;
+                positions_[i] = -1;
+            }
+            capacity_ = capacity;
+            res = true;
+        }
+        else
+        {
+            A::free(entries);
+            A::free(positions);
+        }
+        return res;
+    }
+
+    /**
+     * @brief Destructs and frees arrays of entries and positions.
+     *
+     * @param entries   An array of entries.
+     * @param positions An array of positions.
+     * @param capacity  A number of entries.
+     */
+    static void destruct(Entry* const entries, int32_t* const positions, int32_t const capacity)
+    {
+        if(entries != NULLPTR)
+        {
+            for(int32_t i = 0; i < capacity; i++)
+            {
+                entries[i].~Entry();
+            }
+        }
+        A::free(entries);
+        A::free(positions);
+    }
+
+    /**
+     * @brief Provides space for a number of elements.
+     *
+     * @param length A number of elements.
+     * @return True if this container has the space.
+     */
+    bool_t reserve(int32_t const length)
+    {
+        bool_t res = true;
+        if(length > capacity_)
+        {
+            res = false;
+            if(length <= CAPACITY_MAX)
+            {
+                int32_t capacity = capacity_ * 2;
+                while(capacity < length)
+                {
+                    capacity *= 2;
+                }
+                res = relocate(capacity);
+            }
+        }
+        return res;
+    }
+
+    /**
+     * @brief Moves all entries to new arrays.
+     *
+     * @param capacity A new number of entries.
+     * @return True if the entries are moved.
+     */
+    bool_t relocate(int32_t const capacity)
+    {
+        Entry* const entries = entries_;
+        int32_t* const positions = positions_;
+        int32_t const oldCapacity = capacity_;
+        bool_t const res = construct(capacity);
+        if(res == true)
+        {
+            for(int32_t i = 0; i < oldCapacity; i++)
+            {
+                entries_[i] = entries[i];
+                positions_[i] = positions[i];
+            }
+            destruct(entries, positions, oldCapacity);
+        }
+        return res;
+    }
+
+    /**
+     * @brief Inserts an element put after the last entry.
+     *
+     * @return The handle of the element.
+     */
+    int32_t push()
+    {
+        int32_t const handle = entries_[length_].handle;
+        positions_[handle] = length_;
+        length_++;
+        siftUp(length_ - 1);
+        return handle;
+    }
+
+    /**
+     * @brief Removes an entry.
+     *
+     * The hole of the entry moves to a leaf through the least children, and then the last
+     * entry is put to the hole. The last entry mostly stays there, so moving the hole without
+     * comparing children with the last entry makes less comparisons than the sift down.
+     *
+     * @param index An index of the entry.
+     */
+    void removeAt(int32_t const index)
+    {
+        int32_t const handle = entries_[index].handle;
+        positions_[handle] = -1;
+        length_--;
+        if(index != length_)
+        {
+            int32_t hole = index;
+            while(true)
+            {
+                int32_t const child = getLeastChild(hole);
+                if(child < 0)
+                {
+                    break;
+                }
+                entries_[hole] = entries_[child];
+                positions_[ entries_[hole].handle ] = hole;
+                hole = child;
+            }
+            entries_[hole] = entries_[length_];
+            positions_[ entries_[hole].handle ] = hole;
+            siftUp(hole);
+        }
+        // Keep the free handle beyond the length
+        entries_[length_].element = T();
+        entries_[length_].handle = handle;
+    }
+
+    /**
+     * @brief Moves an entry to the head while it is less than its parent.
+     *
+     * @param index An index of the entry.
+     */
+    void siftUp(int32_t index)
+    {
+        Entry const entry = entries_[index];
+        while(index > 0)
+        {
+            int32_t const parent = (index - 1) / DEGREE;
+            if( C::isLess(entry.element, entries_[parent].element) == false )
+            {
+                break;
+            }
+            entries_[index] = entries_[parent];
+            positions_[ entries_[index].handle ] = index;
+            index = parent;
+        }
+        entries_[index] = entry;
+        positions_[entry.handle] = index;
+    }
+
+    /**
+     * @brief Moves an entry to the tail while its least child is less than it.
+     *
+     * @param index An index of the entry.
+     */
+    void siftDown(int32_t index)
+    {
+        Entry const entry = entries_[index];
+        while(true)
+        {
+            int32_t const child = getLeastChild(index);
+            if( (child < 0) || (C::isLess(entries_[child].element, entry.element) == false) )
+            {
+                break;
+            }
+            entries_[index] = entries_[child];
+            positions_[ entries_[index].handle ] = index;
+            index = child;
+        }
+        entries_[index] = entry;
+        positions_[entry.handle] = index;
+    }
+
+    /**
+     * @brief Returns the least child of an entry.
+     *
+     * @param index An index of the entry.
+     * @return The index of the least child, or -1 if the entry has no children.
+     */
+    int32_t getLeastChild(int32_t const index) const
+    {
+        int32_t child = -1;
+        int32_t const first = index * DEGREE + 1;
+        if(first < length_)
+        {
+            int32_t const last = (first + DEGREE < length_) ? first + DEGREE : length_;
+            child = first;
+            for(int32_t i = first + 1; i < last; i++)
+            {
+                if( C::isLess(entries_[i].element, entries_[child].element) )
+                {
+                    child = i;
+                }
+            }
+        }
+        return child;
+    }
+
+    /**
+     * @brief Tests if a handle is given to an element.
+     *
+     * @param handle A handle.
+     * @return True if the handle is valid.
+     */
+    bool_t isHandle(int32_t const handle) const
+    {
+        return (handle >= 0) && (handle < capacity_) && (positions_[handle] >= 0);
+    }
+
+    /**
+     * @brief Copy constructor.
+     *
+     * @param obj Reference to a source object.
+     */
+    PriorityQueue(const PriorityQueue& obj);
+
+    /**
+     * @brief Copy assignment operator.
+     *
+     * @param obj Reference to a source object.
+     * @return Reference to this object.
+     */
+    PriorityQueue& operator=(const PriorityQueue& obj);
+
+    /**
+     * @brief Array of entries, which first entries are the heap.
+     */
+    Entry* entries_;
+
+    /**
+     * @brief Array of indexes of entries of handles, or -1 for free handles.
+     */
+    int32_t* positions_;
+
+    /**
+     * @brief Number of entries.
+     */
+    int32_t capacity_;
+
+    /**
+     * @brief Number of elements.
+     */
+    int32_t length_;
+
+    /**
+     * @brief Illegal value.
+     */
+    mutable T illegal_;
+
+};
+
+#endif // EOOS_NO_STRICT_MISRA_RULES
+
+} // namespace eoos
+#endif // PRIORITY_QUEUE_HPP_
@@ -0,0 +1,266 @@
+/**
+ * @file      QueueFacade.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef QUEUE_FACADE_HPP_
+#define QUEUE_FACADE_HPP_
+
+#include "api.Queue.hpp"
+
+namespace eoos
+{
+    
+/**
+ * @class QueueFacade<T,Q>
+ * @brief Compile time bound facade of a queue.
+ *
+ * The facade calls functions of a given class by qualified names, so the calls
+ * are bound at compile time and might be inlined, instead of being dispatched
+ * through the virtual table. The specialization for the interface calls them virtually.
+ *
+ * @tparam T Data type of queue element.
+ * @tparam Q A queue class implementing the api::Queue<T> interface.
+ */
+template <typename T, class Q = api::Queue<T> >
+class QueueFacade
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param object An object to call functions of.
+     */
+    explicit QueueFacade(Q& object) :
+        object_ (object){
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~QueueFacade()
+    {
+    }
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const
+    {
+        return object_.Q::isConstructed();
+    }
+
+    /**
+     * @copydoc eoos::api::Collection::getLength()
+     */
+    int32_t getLength() const
+    {
+        return object_.Q::getLength();
+    }
+
+    /**
+     * @copydoc eoos::api::Collection::isEmpty()
+     */
+    bool_t isEmpty() const
+    {
+        return object_.Q::isEmpty();
+    }
+
+    /**
+     * @copydoc eoos::api::Queue::add(const T&)
+     */
+    bool_t add(const T& element)
+    {
+        return object_.Q::add(element);
+    }
+
+    #if EOOS_CPP_STANDARD >= 2011
+
+    /**
+     * @copydoc eoos::api::Queue::add(T&&)
+     */
+    bool_t add(T&& element)
+    {
+        return object_.Q::add(static_cast<T&&>(element));
+    }
+
+    /**
+     * @copydoc eoos::api::Queue::emplace(Args&&...)
+     */
+    template <typename... Args>
+    bool_t emplace(Args&&... args)
+    {
+        T element(static_cast<Args&&>(args)...);
+        return object_.Q::add(static_cast<T&&>(element));
+    }
+
+    #endif // EOOS_CPP_STANDARD >= 2011
+
+    /**
+     * @copydoc eoos::api::Queue::remove()
+     */
+    bool_t remove()
+    {
+        return object_.Q::remove();
+    }
+
+    /**
+     * @copydoc eoos::api::Queue::peek()
+     */
+    T& peek() const
+    {
+        return object_.Q::peek();
+    }
+
+    /**
+     * @copydoc eoos::api::Queue::addAll(const T*,int32_t)
+     */
+    bool_t addAll(const T* const elements, int32_t const number)
+    {
+        return object_.Q::addAll(elements, number);
+    }
+
+    /**
+     * @copydoc eoos::api::Queue::copyTo(T*,int32_t)
+     */
+    int32_t copyTo(T* const elements, int32_t const number) const
+    {
+        return object_.Q::copyTo(elements, number);
+    }
+
+private:
+
+    /**
+     * @brief The object functions are called of.
+     */
+    Q& object_;
+
+};
+
+/**
+ * @class QueueFacade<T,api::Queue<T> >
+ * @brief Virtual facade of a queue.
+ *
+ * The specialization calls functions of the interface virtually.
+ */
+template <typename T>
+class QueueFacade<T,api::Queue<T> >
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param object An object to call functions of.
+     */
+    explicit QueueFacade(api::Queue<T>& object) :
+        object_ (object){
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~QueueFacade()
+    {
+    }
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const
+    {
+        return object_.isConstructed();
+    }
+
+    /**
+     * @copydoc eoos::api::Collection::getLength()
+     */
+    int32_t getLength() const
+    {
+        return object_.getLength();
+    }
+
+    /**
+     * @copydoc eoos::api::Collection::isEmpty()
+     */
+    bool_t isEmpty() const
+    {
+        return object_.isEmpty();
+    }
+
+    /**
+     * @copydoc eoos::api::Queue::add(const T&)
+     */
+    bool_t add(const T& element)
+    {
+        return object_.add(element);
+    }
+
+    #if EOOS_CPP_STANDARD >= 2011
+
+    /**
+     * @copydoc eoos::api::Queue::add(T&&)
+     */
+    bool_t add(T&& element)
+    {
+        return object_.add(static_cast<T&&>(element));
+    }
+
+    /**
+     * @copydoc eoos::api::Queue::emplace(Args&&...)
+     */
+    template <typename... Args>
+    bool_t emplace(Args&&... args)
+    {
+        T element(static_cast<Args&&>(args)...);
+        return object_.add(static_cast<T&&>(element));
+    }
+
+    #endif // EOOS_CPP_STANDARD >= 2011
+
+    /**
+     * @copydoc eoos::api::Queue::remove()
+     */
+    bool_t remove()
+    {
+        return object_.remove();
+    }
+
+    /**
+     * @copydoc eoos::api::Queue::peek()
+     */
+    T& peek() const
+    {
+        return object_.peek();
+    }
+
+    /**
+     * @copydoc eoos::api::Queue::addAll(const T*,int32_t)
+     */
+    bool_t addAll(const T* const elements, int32_t const number)
+    {
+        return object_.addAll(elements, number);
+    }
+
+    /**
+     * @copydoc eoos::api::Queue::copyTo(T*,int32_t)
+     */
+    int32_t copyTo(T* const elements, int32_t const number) const
+    {
+        return object_.copyTo(elements, number);
+    }
+
+private:
+
+    /**
+     * @brief The object functions are called of.
+     */
+    api::Queue<T>& object_;
+
+};
+
+} // namespace eoos
+#endif // QUEUE_FACADE_HPP_
@@ -0,0 +1,54 @@
+/**
+ * @file      Singleton.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SINGLETON_HPP_
+#define SINGLETON_HPP_
+
+#include "Types.hpp"
+
+namespace eoos
+{
+    
+/**
+ * @class Singleton<T>
+ * @brief Lazy construction of an object in static storage.
+ *
+ * The object is constructed on the first call of the getter, not at the system startup,
+ * and its memory is not allocated from heap, therefore subsystems which a program
+ * does not use are never constructed.
+ *
+ * @note Since C++11 the first call is thread-safe, and for earlier standards
+ * the first call must be done before other threads are created.
+ *
+ * @tparam T Class of the object to be constructed with the default constructor.
+ */
+template <class T>
+class Singleton
+{
+
+public:
+
+    /**
+     * @brief Returns the object constructing it if it has not been constructed yet.
+     *
+     * @return The object.
+     */
+    static T& getInstance()
+    {
+        static T instance;
+        return instance;
+    }
+
+private:
+
+    /**
+     * @brief Constructor.
+     */
+    Singleton();
+
+};
+  
+} // namespace eoos
+#endif // SINGLETON_HPP_
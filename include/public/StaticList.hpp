@@ -0,0 +1,578 @@
+/**
+ * @file      StaticList.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef STATIC_LIST_HPP_
+#define STATIC_LIST_HPP_
+
+#include "Object.hpp"
+#include "api.List.hpp"
+#include "ArrayCopy.hpp"
+#include "api.ListIterator.hpp"
+
+namespace eoos
+{
+
+/**
+ * @class StaticList<T,L,A>
+ * @brief List of static capacity.
+ *
+ * The list keeps elements in an array embedded into the list object, so it
+ * never allocates memory for elements and might be used if the heap memory
+ * is not available. Elements are inserted and removed by shifting following elements.
+ *
+ * @note Data type of elements must be default constructible and copy assignable.
+ *
+ * @tparam T Data type of list element.
+ * @tparam L Maximum number of elements.
+ * @tparam A Heap memory allocator class.
+ */
+template <typename T, int32_t L, class A = Allocator>
+class StaticList : public Object<A>, public api::List<T>
+{
+    typedef Object<A> Parent;
+
+    #if EOOS_CPP_STANDARD >= 2011
+    static_assert(L > 0, "Maximum number of elements must be positive");
+    #else
+    typedef int8_t CapacityCheck[(L > 0) ? 1 : -1];
+    #endif
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    StaticList() : Parent(),
+        elements_ (),
+        length_   (0),
+        illegal_  (){
+        this->setConstructed( L > 0 );
+    }
+
+    /**
+     * @brief Constructor.
+     *
+     * @param illegal An illegal value.
+     */
+    explicit StaticList(const T& illegal) : Parent(),
+        elements_ (),
+        length_   (0),
+        illegal_  (illegal){
+        this->setConstructed( L > 0 );
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~StaticList()
+    {
+    }
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const
+    {
+        return Parent::isConstructed();
+    }
+
+    /**
+     * @copydoc eoos::api::Collection::getLength()
+     */
+    virtual int32_t getLength() const
+    {
+        return length_;
+    }
+
+    /**
+     * @copydoc eoos::api::Collection::isEmpty()
+     */
+    virtual bool_t isEmpty() const
+    {
+        return length_ == 0;
+    }
+
+    /**
+     * @copydoc eoos::api::List::add(const T&)
+     */
+    virtual bool_t add(const T& element)
+    {
+        return add(length_, element);
+    }
+
+    /**
+     * @copydoc eoos::api::List::add(int32_t,const T&)
+     */
+    virtual bool_t add(int32_t const index, const T& element)
+    {
+        bool_t res = false;
+        if( isConstructed() && (length_ < L) && (index >= 0) && (index <= length_) )
+        {
+            shift(index, 1);
+            elements_[index] = element;
+            res = true;
+        }
+        return res;
+    }
+
+    #if EOOS_CPP_STANDARD >= 2011
+
+    /**
+     * @copydoc eoos::api::List::add(T&&)
+     */
+    virtual bool_t add(T&& element)
+    {
+        return add(length_, static_cast<T&&>(element));
+    }
+
+    /**
+     * @copydoc eoos::api::List::add(int32_t,T&&)
+     */
+    virtual bool_t add(int32_t const index, T&& element)
+    {
+        bool_t res = false;
+        if( isConstructed() && (length_ < L) && (index >= 0) && (index <= length_) )
+        {
+            shift(index, 1);
+            elements_[index] = static_cast<T&&>(element);
+            res = true;
+        }
+        return res;
+    }
+
+    #endif // EOOS_CPP_STANDARD >= 2011
+
+    /**
+     * @copydoc eoos::api::List::addAll(const T*,int32_t)
+     */
+    virtual bool_t addAll(const T* const elements, int32_t const number)
+    {
+        bool_t res = false;
+        if( isConstructed() && (elements != NULLPTR) && (number >= 0) && (number <= L - length_) )
+        {
+            ArrayCopy<T>::copy(elements_ + length_, elements, number);
+            length_ += number;
+            res = true;
+        }
+        return res;
+    }
+
+    /**
+     * @copydoc eoos::api::List::clear()
+     */
+    virtual void clear()
+    {
+        static_cast<void>( removeRange(0, length_) );
+    }
+
+    /**
+     * @copydoc eoos::api::List::remove(int32_t)
+     */
+    virtual bool_t remove(int32_t const index)
+    {
+        return removeRange(index, index + 1);
+    }
+
+    /**
+     * @copydoc eoos::api::List::removeFirst()
+     */
+    virtual bool_t removeFirst()
+    {
+        return remove(0);
+    }
+
+    /**
+     * @copydoc eoos::api::List::removeLast()
+     */
+    virtual bool_t removeLast()
+    {
+        return remove(length_ - 1);
+    }
+
+    /**
+     * @copydoc eoos::api::List::removeElement(const T&)
+     */
+    virtual bool_t removeElement(const T& element)
+    {
+        return remove( getIndexOf(element) );
+    }
+
+    /**
+     * @copydoc eoos::api::List::removeRange(int32_t,int32_t)
+     */
+    virtual bool_t removeRange(int32_t const from, int32_t const to)
+    {
+        bool_t res = false;
+        if( isConstructed() && (from >= 0) && (from <= to) && (to <= length_) )
+        {
+            int32_t const number = to - from;
+            ArrayCopy<T>::move(elements_ + from, elements_ + to, length_ - to);
+            for(int32_t i = length_ - number; i < length_; i++)
+            {
+                elements_[i] = T();
+            }
+            length_ -= number;
+            res = true;
+        }
+        return res;
+    }
+
+    /**
+     * @copydoc eoos::api::List::get(int32_t)
+     */
+    virtual T& get(int32_t const index) const
+    {
+        return isIndex(index) ? elements_[index] : illegal_;
+    }
+
+    /**
+     * @copydoc eoos::api::List::getFirst()
+     */
+    virtual T& getFirst() const
+    {
+        return get(0);
+    }
+
+    /**
+     * @copydoc eoos::api::List::getLast()
+     */
+    virtual T& getLast() const
+    {
+        return get(length_ - 1);
+    }
+
+    /**
+     * @copydoc eoos::api::List::getListIterator(int32_t)
+     *
+     * @note Iterators are allocated in the heap memory, so NULLPTR is returned if strict MISRA rules are applied.
+     */
+    virtual api::ListIterator<T>* getListIterator(int32_t const index)
+    {
+        api::ListIterator<T>* res = NULLPTR;
+        #ifdef EOOS_NO_STRICT_MISRA_RULES
+        if( isConstructed() && (index >= 0) && (index <= length_) )
+        {
+            api::ListIterator<T>* const iterator = new Iterator(index, *this);
+            if( Parent::isConstructed(iterator) )
+            {
+                res = iterator;
+            }
+            else
+            {
+                delete iterator;
+            }
+        }
+        #else
+        static_cast<void>(index);
+        #endif // EOOS_NO_STRICT_MISRA_RULES
+        return res;
+    }
+
+    /**
+     * @copydoc eoos::api::List::getIndexOf(const T&)
+     */
+    virtual int32_t getIndexOf(const T& element) const
+    {
+        int32_t res = -1;
+        if( isConstructed() )
+        {
+            for(int32_t i = 0; i < length_; i++)
+            {
+                if(elements_[i] == element)
+                {
+                    res = i;
+                    break;
+                }
+            }
+        }
+        return res;
+    }
+
+    /**
+     * @copydoc eoos::api::List::isIndex(int32_t)
+     */
+    virtual bool_t isIndex(int32_t const index) const
+    {
+        return isConstructed() && (index >= 0) && (index < length_);
+    }
+
+    /**
+     * @copydoc eoos::api::List::copyTo(T*,int32_t)
+     */
+    virtual int32_t copyTo(T* const elements, int32_t const number) const
+    {
+        int32_t res = -1;
+        if( isConstructed() && (elements != NULLPTR) && (number >= 0) )
+        {
+            res = (number < length_) ? number : length_;
+            ArrayCopy<T>::copy(elements, elements_, res);
+        }
+        return res;
+    }
+
+    /**
+     * @copydoc eoos::api::IllegalValue::getIllegal()
+     */
+    virtual T& getIllegal() const
+    {
+        return illegal_;
+    }
+
+    /**
+     * @copydoc eoos::api::IllegalValue::setIllegal(const T&)
+     */
+    virtual void setIllegal(const T& value)
+    {
+        illegal_ = value;
+    }
+
+    /**
+     * @copydoc eoos::api::IllegalValue::isIllegal(const T&)
+     */
+    virtual bool_t isIllegal(const T& value) const
+    {
+        return illegal_ == value;
+    }
+
+private:
+
+    /**
+     * @brief Shifts elements from a position to the end.
+     *
+     * @param index  A position of the first shifted element.
+     * @param number A number of positions to shift by.
+     */
+    void shift(int32_t const index, int32_t const number)
+    {
+        ArrayCopy<T>::move(elements_ + index + number, elements_ + index, length_ - index);
+        length_ += number;
+    }
+
+    #ifdef EOOS_NO_STRICT_MISRA_RULES
+
+    /**
+     * @class Iterator
+     * @brief List iterator of a static list.
+     */
+    class Iterator : public Object<A>, public api::ListIterator<T>
+    {
+        typedef Object<A> Parent;
+
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param index Start position in a list.
+         * @param list  A list to iterate.
+         */
+        Iterator(int32_t const index, StaticList& list) : Parent(),
+            list_  (list),
+            index_ (index),
+            last_  (-1){
+        }
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~Iterator()
+        {
+        }
+
+        /**
+         * @copydoc eoos::api::Object::isConstructed()
+         */
+        virtual bool_t isConstructed() const
+        {
+            return Parent::isConstructed();
+        }
+
+        /**
+         * @copydoc eoos::api::ListIterator::add(const T&)
+         */
+        virtual bool_t add(const T& element)
+        {
+            bool_t const res = list_.add(index_, element);
+            if(res == true)
+            {
+                index_++;
+                last_ = -1;
+            }
+            return res;
+        }
+
+        /**
+         * @copydoc eoos::api::Iterator::remove()
+         */
+        virtual bool_t remove()
+        {
+            bool_t const res = list_.remove(last_);
+            if(res == true)
+            {
+                if(last_ < index_)
+                {
+                    index_--;
+                }
+                last_ = -1;
+            }
+            return res;
+        }
+
+        /**
+         * @copydoc eoos::api::ListIterator::getPrevious()
+         */
+        virtual T& getPrevious() const
+        {
+            T* element = &list_.illegal_;
+            if( hasPrevious() )
+            {
+                index_--;
+                last_ = index_;
+                element = &list_.elements_[index_];
+            }
+            return *element;
+        }
+
+        /**
+         * @copydoc eoos::api::Iterator::getNext()
+         */
+        virtual T& getNext() const
+        {
+            T* element = &list_.illegal_;
+            if( hasNext() )
+            {
+                last_ = index_;
+                element = &list_.elements_[index_];
+                index_++;
+            }
+            return *element;
+        }
+
+        /**
+         * @copydoc eoos::api::ListIterator::hasPrevious()
+         */
+        virtual bool_t hasPrevious() const
+        {
+            return index_ > 0;
+        }
+
+        /**
+         * @copydoc eoos::api::Iterator::hasNext()
+         */
+        virtual bool_t hasNext() const
+        {
+            return index_ < list_.length_;
+        }
+
+        /**
+         * @copydoc eoos::api::ListIterator::getNextIndex()
+         */
+        virtual int32_t getNextIndex() const
+        {
+            return index_;
+        }
+
+        /**
+         * @copydoc eoos::api::ListIterator::getPreviousIndex()
+         */
+        virtual int32_t getPreviousIndex() const
+        {
+            return index_ - 1;
+        }
+
+        /**
+         * @copydoc eoos::api::IllegalValue::getIllegal()
+         */
+        virtual T& getIllegal() const
+        {
+            return list_.illegal_;
+        }
+
+        /**
+         * @copydoc eoos::api::IllegalValue::setIllegal(const T&)
+         */
+        virtual void setIllegal(const T& value)
+        {
+            list_.illegal_ = value;
+        }
+
+        /**
+         * @copydoc eoos::api::IllegalValue::isIllegal(const T&)
+         */
+        virtual bool_t isIllegal(const T& value) const
+        {
+            return list_.illegal_ == value;
+        }
+
+    private:
+
+        /**
+         * @brief Copy constructor.
+         *
+         * @param obj Reference to a source object.
+         */
+        Iterator(const Iterator& obj);
+
+        /**
+         * @brief Copy assignment operator.
+         *
+         * @param obj Reference to a source object.
+         * @return Reference to this object.
+         */
+        Iterator& operator=(const Iterator& obj);
+
+        /**
+         * @brief The list of this iterator.
+         */
+        StaticList& list_;
+
+        /**
+         * @brief Position of the next element.
+         */
+        mutable int32_t index_;
+
+        /**
+         * @brief Position of the last returned element, or -1.
+         */
+        mutable int32_t last_;
+
+    };
+
+    #endif // EOOS_NO_STRICT_MISRA_RULES
+
+    /**
+     * @brief Copy constructor.
+     *
+     * @param obj Reference to a source object.
+     */
+    StaticList(const StaticList& obj);
+
+    /**
+     * @brief Copy assignment operator.
+     *
+     * @param obj Reference to a source object.
+     * @return Reference to this object.
+     */
+    StaticList& operator=(const StaticList& obj);
+
+    /**
+     * @brief Array of elements.
+     */
+    mutable T elements_[L];
+
+    /**
+     * @brief Number of elements.
+     */
+    int32_t length_;
+
+    /**
+     * @brief Illegal value.
+     */
+    mutable T illegal_;
+
+};
+
+} // namespace eoos
+#endif // STATIC_LIST_HPP_
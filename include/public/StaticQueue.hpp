@@ -0,0 +1,267 @@
+/**
+ * @file      StaticQueue.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef STATIC_QUEUE_HPP_
+#define STATIC_QUEUE_HPP_
+
+#include "Object.hpp"
+#include "api.Queue.hpp"
+#include "ArrayCopy.hpp"
+
+namespace eoos
+{
+
+/**
+ * @class StaticQueue<T,L,A>
+ * @brief Queue of static capacity.
+ *
+ * The queue is a ring buffer embedded into the queue object, so it never
+ * allocates memory for elements and might be used if the heap memory is not
+ * available, and it inserts and removes elements in constant time.
+ *
+ * @note Data type of elements must be default constructible and copy assignable.
+ *
+ * @tparam T Data type of queue element.
+ * @tparam L Maximum number of elements.
+ * @tparam A Heap memory allocator class.
+ */
+template <typename T, int32_t L, class A = Allocator>
+class StaticQueue : public Object<A>, public api::Queue<T>
+{
+    typedef Object<A> Parent;
+
+    #if EOOS_CPP_STANDARD >= 2011
+    static_assert(L > 0, "Maximum number of elements must be positive");
+    #else
+    typedef int8_t CapacityCheck[(L > 0) ? 1 : -1];
+    #endif
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    StaticQueue() : Parent(),
+        elements_ (),
+        head_     (0),
+        length_   (0),
+        illegal_  (){
+        this->setConstructed( L > 0 );
+    }
+
+    /**
+     * @brief Constructor.
+     *
+     * @param illegal An illegal value.
+     */
+    explicit StaticQueue(const T& illegal) : Parent(),
+        elements_ (),
+        head_     (0),
+        length_   (0),
+        illegal_  (illegal){
+        this->setConstructed( L > 0 );
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~StaticQueue()
+    {
+    }
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const
+    {
+        return Parent::isConstructed();
+    }
+
+    /**
+     * @copydoc eoos::api::Collection::getLength()
+     */
+    virtual int32_t getLength() const
+    {
+        return length_;
+    }
+
+    /**
+     * @copydoc eoos::api::Collection::isEmpty()
+     */
+    virtual bool_t isEmpty() const
+    {
+        return length_ == 0;
+    }
+
+    /**
+     * @copydoc eoos::api::Queue::add(const T&)
+     */
+    virtual bool_t add(const T& element)
+    {
+        bool_t res = false;
+        if( isConstructed() && (length_ < L) )
+        {
+            elements_[ getPosition(length_) ] = element;
+            length_++;
+            res = true;
+        }
+        return res;
+    }
+
+    #if EOOS_CPP_STANDARD >= 2011
+
+    /**
+     * @copydoc eoos::api::Queue::add(T&&)
+     */
+    virtual bool_t add(T&& element)
+    {
+        bool_t res = false;
+        if( isConstructed() && (length_ < L) )
+        {
+            elements_[ getPosition(length_) ] = static_cast<T&&>(element);
+            length_++;
+            res = true;
+        }
+        return res;
+    }
+
+    #endif // EOOS_CPP_STANDARD >= 2011
+
+    /**
+     * @copydoc eoos::api::Queue::addAll(const T*,int32_t)
+     */
+    virtual bool_t addAll(const T* const elements, int32_t const number)
+    {
+        bool_t res = false;
+        if( isConstructed() && (elements != NULLPTR) && (number >= 0) && (number <= L - length_) )
+        {
+            // The ring buffer is filled by two parts at most, the tail part and the head part
+            int32_t const tail = getPosition(length_);
+            int32_t const first = (number < L - tail) ? number : L - tail;
+            ArrayCopy<T>::copy(elements_ + tail, elements, first);
+            ArrayCopy<T>::copy(elements_, elements + first, number - first);
+            length_ += number;
+            res = true;
+        }
+        return res;
+    }
+
+    /**
+     * @copydoc eoos::api::Queue::remove()
+     */
+    virtual bool_t remove()
+    {
+        bool_t res = false;
+        if( isConstructed() && (length_ > 0) )
+        {
+            elements_[head_] = T();
+            head_ = getPosition(1);
+            length_--;
+            res = true;
+        }
+        return res;
+    }
+
+    /**
+     * @copydoc eoos::api::Queue::peek()
+     */
+    virtual T& peek() const
+    {
+        return ( isConstructed() && (length_ > 0) ) ? elements_[head_] : illegal_;
+    }
+
+    /**
+     * @copydoc eoos::api::Queue::copyTo(T*,int32_t)
+     */
+    virtual int32_t copyTo(T* const elements, int32_t const number) const
+    {
+        int32_t res = -1;
+        if( isConstructed() && (elements != NULLPTR) && (number >= 0) )
+        {
+            res = (number < length_) ? number : length_;
+            int32_t const first = (res < L - head_) ? res : L - head_;
+            ArrayCopy<T>::copy(elements, elements_ + head_, first);
+            ArrayCopy<T>::copy(elements + first, elements_, res - first);
+        }
+        return res;
+    }
+
+    /**
+     * @copydoc eoos::api::IllegalValue::getIllegal()
+     */
+    virtual T& getIllegal() const
+    {
+        return illegal_;
+    }
+
+    /**
+     * @copydoc eoos::api::IllegalValue::setIllegal(const T&)
+     */
+    virtual void setIllegal(const T& value)
+    {
+        illegal_ = value;
+    }
+
+    /**
+     * @copydoc eoos::api::IllegalValue::isIllegal(const T&)
+     */
+    virtual bool_t isIllegal(const T& value) const
+    {
+        return illegal_ == value;
+    }
+
+private:
+
+    /**
+     * @brief Returns a position of an element in the ring buffer.
+     *
+     * @param index An index of the element from the head.
+     * @return The position.
+     */
+    int32_t getPosition(int32_t const index) const
+    {
+        int32_t const position = head_ + index;
+        return (position < L) ? position : position - L;
+    }
+
+    /**
+     * @brief Copy constructor.
+     *
+     * @param obj Reference to a source object.
+     */
+    StaticQueue(const StaticQueue& obj);
+
+    /**
+     * @brief Copy assignment operator.
+     *
+     * @param obj Reference to a source object.
+     * @return Reference to this object.
+     */
+    StaticQueue& operator=(const StaticQueue& obj);
+
+    /**
+     * @brief Ring buffer of elements.
+     */
+    mutable T elements_[L];
+
+    /**
+     * @brief Position of the head element.
+     */
+    int32_t head_;
+
+    /**
+     * @brief Number of elements.
+     */
+    int32_t length_;
+
+    /**
+     * @brief Illegal value.
+     */
+    mutable T illegal_;
+
+};
+
+} // namespace eoos
+#endif // STATIC_QUEUE_HPP_
@@ -0,0 +1,231 @@
+/**
+ * @file      StaticStack.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef STATIC_STACK_HPP_
+#define STATIC_STACK_HPP_
+
+#include "Object.hpp"
+#include "api.Collection.hpp"
+#include "api.IllegalValue.hpp"
+
+namespace eoos
+{
+
+/**
+ * @class StaticStack<T,L,A>
+ * @brief LIFO stack of static capacity.
+ *
+ * The stack keeps elements in an array embedded into the stack object, so it
+ * never allocates memory for elements and might be used if the heap memory is not available.
+ *
+ * @note Data type of elements must be default constructible and copy assignable.
+ *
+ * @tparam T Data type of stack element.
+ * @tparam L Maximum number of elements.
+ * @tparam A Heap memory allocator class.
+ */
+template <typename T, int32_t L, class A = Allocator>
+class StaticStack : public Object<A>, public api::Collection<T>, public api::IllegalValue<T>
+{
+    typedef Object<A> Parent;
+
+    #if EOOS_CPP_STANDARD >= 2011
+    static_assert(L > 0, "Maximum number of elements must be positive");
+    #else
+    typedef int8_t CapacityCheck[(L > 0) ? 1 : -1];
+    #endif
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    StaticStack() : Parent(),
+        elements_ (),
+        length_   (0),
+        illegal_  (){
+        this->setConstructed( L > 0 );
+    }
+
+    /**
+     * @brief Constructor.
+     *
+     * @param illegal An illegal value.
+     */
+    explicit StaticStack(const T& illegal) : Parent(),
+        elements_ (),
+        length_   (0),
+        illegal_  (illegal){
+        this->setConstructed( L > 0 );
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~StaticStack()
+    {
+    }
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const
+    {
+        return Parent::isConstructed();
+    }
+
+    /**
+     * @copydoc eoos::api::Collection::getLength()
+     */
+    virtual int32_t getLength() const
+    {
+        return length_;
+    }
+
+    /**
+     * @copydoc eoos::api::Collection::isEmpty()
+     */
+    virtual bool_t isEmpty() const
+    {
+        return length_ == 0;
+    }
+
+    /**
+     * @brief Inserts a new element to the top of this stack.
+     *
+     * @param element An inserting element.
+     * @return True if element is added.
+     */
+    bool_t push(const T& element)
+    {
+        bool_t res = false;
+        if( isConstructed() && (length_ < L) )
+        {
+            elements_[length_] = element;
+            length_++;
+            res = true;
+        }
+        return res;
+    }
+
+    #if EOOS_CPP_STANDARD >= 2011
+
+    /**
+     * @brief Inserts a new element to the top of this stack.
+     *
+     * @param element An inserting element to be moved.
+     * @return True if element is added.
+     */
+    bool_t push(T&& element)
+    {
+        bool_t res = false;
+        if( isConstructed() && (length_ < L) )
+        {
+            elements_[length_] = static_cast<T&&>(element);
+            length_++;
+            res = true;
+        }
+        return res;
+    }
+
+    #endif // EOOS_CPP_STANDARD >= 2011
+
+    /**
+     * @brief Removes the top element of this stack.
+     *
+     * @return True if an element is removed successfully.
+     */
+    bool_t pop()
+    {
+        bool_t res = false;
+        if( isConstructed() && (length_ > 0) )
+        {
+            length_--;
+            elements_[length_] = T();
+            res = true;
+        }
+        return res;
+    }
+
+    /**
+     * @brief Examines the top element of this stack.
+     *
+     * @return The top element.
+     */
+    T& peek() const
+    {
+        return ( isConstructed() && (length_ > 0) ) ? elements_[length_ - 1] : illegal_;
+    }
+
+    /**
+     * @brief Removes all elements from this stack.
+     */
+    void clear()
+    {
+        while( pop() )
+        {
+        }
+    }
+
+    /**
+     * @copydoc eoos::api::IllegalValue::getIllegal()
+     */
+    virtual T& getIllegal() const
+    {
+        return illegal_;
+    }
+
+    /**
+     * @copydoc eoos::api::IllegalValue::setIllegal(const T&)
+     */
+    virtual void setIllegal(const T& value)
+    {
+        illegal_ = value;
+    }
+
+    /**
+     * @copydoc eoos::api::IllegalValue::isIllegal(const T&)
+     */
+    virtual bool_t isIllegal(const T& value) const
+    {
+        return illegal_ == value;
+    }
+
+private:
+
+    /**
+     * @brief Copy constructor.
+     *
+     * @param obj Reference to a source object.
+     */
+    StaticStack(const StaticStack& obj);
+
+    /**
+     * @brief Copy assignment operator.
+     *
+     * @param obj Reference to a source object.
+     * @return Reference to this object.
+     */
+    StaticStack& operator=(const StaticStack& obj);
+
+    /**
+     * @brief Array of elements, which last element is the top.
+     */
+    mutable T elements_[L];
+
+    /**
+     * @brief Number of elements.
+     */
+    int32_t length_;
+
+    /**
+     * @brief Illegal value.
+     */
+    mutable T illegal_;
+
+};
+
+} // namespace eoos
+#endif // STATIC_STACK_HPP_
@@ -0,0 +1,245 @@
+/**
+ * @file      StaticString.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef STATIC_STRING_HPP_
+#define STATIC_STRING_HPP_
+
+#include "Object.hpp"
+#include "api.String.hpp"
+
+namespace eoos
+{
+
+/**
+ * @class StaticString<T,L,A>
+ * @brief String of static capacity.
+ *
+ * The string keeps characters in an array embedded into the string object, so
+ * it never allocates memory and might be used if the heap memory is not available.
+ * A string which does not fit the capacity is neither copied nor concatenated.
+ *
+ * @tparam T Data type of string characters, which default value is the terminating character.
+ * @tparam L Maximum number of characters without the terminating character.
+ * @tparam A Heap memory allocator class.
+ */
+template <typename T, int32_t L, class A = Allocator>
+class StaticString : public Object<A>, public api::String<T>
+{
+    typedef Object<A> Parent;
+
+    #if EOOS_CPP_STANDARD >= 2011
+    static_assert(L > 0, "Maximum number of characters must be positive");
+    #else
+    typedef int8_t CapacityCheck[(L > 0) ? 1 : -1];
+    #endif
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    StaticString() : Parent(),
+        chars_  (),
+        length_ (0){
+        this->setConstructed( L > 0 );
+    }
+
+    /**
+     * @brief Constructor.
+     *
+     * @param string A string to be copied.
+     */
+    explicit StaticString(const T* const string) : Parent(),
+        chars_  (),
+        length_ (0){
+        bool_t const isConstructed = (L > 0) && copy(string);
+        this->setConstructed( isConstructed );
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~StaticString()
+    {
+    }
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const
+    {
+        return Parent::isConstructed();
+    }
+
+    /**
+     * @copydoc eoos::api::Collection::getLength()
+     */
+    virtual int32_t getLength() const
+    {
+        return length_;
+    }
+
+    /**
+     * @copydoc eoos::api::Collection::isEmpty()
+     */
+    virtual bool_t isEmpty() const
+    {
+        return length_ == 0;
+    }
+
+    /**
+     * @copydoc eoos::api::String::copy(const String<T>&)
+     */
+    virtual bool_t copy(const api::String<T>& string)
+    {
+        return copy( string.getChar() );
+    }
+
+    /**
+     * @brief Copies a passed string into this string.
+     *
+     * @param string A string to be copied.
+     * @return True if a passed string has been copied successfully.
+     */
+    bool_t copy(const T* const string)
+    {
+        bool_t res = false;
+        if( isConstructed() && (string != NULLPTR) )
+        {
+            int32_t const length = getLength(string);
+            if(length <= L)
+            {
+                // Copy through the terminating character as the string might be a part of this string
+                for(int32_t i = 0; i <= length; i++)
+                {
+                    chars_[i] = string[i];
+                }
+                length_ = length;
+                res = true;
+            }
+        }
+        return res;
+    }
+
+    /**
+     * @copydoc eoos::api::String::concatenate(const String<T>&)
+     */
+    virtual bool_t concatenate(const api::String<T>& string)
+    {
+        return concatenate( string.getChar() );
+    }
+
+    /**
+     * @brief Concatenates a passed string to this string.
+     *
+     * @param string A string to be appended.
+     * @return True if a passed string has been appended successfully.
+     */
+    bool_t concatenate(const T* const string)
+    {
+        bool_t res = false;
+        if( isConstructed() && (string != NULLPTR) )
+        {
+            int32_t const length = getLength(string);
+            if(length <= L - length_)
+            {
+                for(int32_t i = 0; i < length; i++)
+                {
+                    chars_[length_ + i] = string[i];
+                }
+                length_ += length;
+                chars_[length_] = T();
+                res = true;
+            }
+        }
+        return res;
+    }
+
+    /**
+     * @copydoc eoos::api::String::compare(const String<T>&)
+     */
+    virtual int32_t compare(const api::String<T>& string) const
+    {
+        int32_t res = COMPARE_ERROR;
+        const T* const chars = string.getChar();
+        if( isConstructed() && (chars != NULLPTR) )
+        {
+            res = 0;
+            for(int32_t i = 0; i <= length_; i++)
+            {
+                if(chars_[i] != chars[i])
+                {
+                    res = (chars_[i] < chars[i]) ? -1 : 1;
+                    break;
+                }
+                if(chars[i] == T())
+                {
+                    break;
+                }
+            }
+        }
+        return res;
+    }
+
+    /**
+     * @copydoc eoos::api::String::getChar()
+     */
+    virtual const T* getChar() const
+    {
+        return isConstructed() ? chars_ : NULLPTR;
+    }
+
+private:
+
+    /**
+     * @brief Result of comparison if an error has been occurred.
+     */
+    static const int32_t COMPARE_ERROR = -2147483647 - 1;
+
+    /**
+     * @brief Returns a length of a string.
+     *
+     * @param string A string.
+     * @return Number of characters without the terminating character.
+     */
+    static int32_t getLength(const T* const string)
+    {
+        int32_t length = 0;
+        while( (string[length] != T()) && (length <= L) )
+        {
+            length++;
+        }
+        return length;
+    }
+
+    /**
+     * @brief Copy constructor.
+     *
+     * @param obj Reference to a source object.
+     */
+    StaticString(const StaticString& obj);
+
+    /**
+     * @brief Copy assignment operator.
+     *
+     * @param obj Reference to a source object.
+     * @return Reference to this object.
+     */
+    StaticString& operator=(const StaticString& obj);
+
+    /**
+     * @brief Characters with the terminating character.
+     */
+    T chars_[L + 1];
+
+    /**
+     * @brief Number of characters without the terminating character.
+     */
+    int32_t length_;
+
+};
+
+} // namespace eoos
+#endif // STATIC_STRING_HPP_
@@ -0,0 +1,92 @@
+/**
+ * @file      ValueObject.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef VALUE_OBJECT_HPP_
+#define VALUE_OBJECT_HPP_
+
+#include "ObjectAllocator.hpp"
+
+namespace eoos
+{
+    
+/**
+ * @class ValueObject<A>
+ * @brief Root class of value types.
+ *
+ * The class is an alternative to Object<A> for small types which construction
+ * cannot fail. It has no virtual functions and no constructed flag, so it
+ * adds no memory to derived types, and arrays of them are dense. Since C++11
+ * the class is trivially destructible, so derived types might be trivially
+ * destructible too.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A = Allocator>
+class ValueObject : public ObjectAllocator<A>
+{
+
+public:
+
+    /**
+     * @brief Tests if this object has been constructed.
+     *
+     * @return Always true as construction of value types cannot fail.
+     */
+    bool_t isConstructed() const
+    {
+        return true;
+    }
+
+    /**
+     * @brief Tests if an object has been constructed.
+     *
+     * @param obj Object to be tested.
+     * @return True if object is not NULLPTR.
+     */
+    static bool_t isConstructed(const ValueObject* const obj)
+    {
+        return obj != NULLPTR;
+    }
+
+protected:
+
+    #if EOOS_CPP_STANDARD >= 2011
+
+    /**
+     * @brief Constructor.
+     */
+    ValueObject() = default;
+
+    /**
+     * @brief Destructor.
+     *
+     * The destructor is not virtual, so derived objects must not be deleted through this class.
+     */
+    ~ValueObject() = default;
+
+    #else
+
+    /**
+     * @brief Constructor.
+     */
+    ValueObject()
+    {
+    }
+
+    /**
+     * @brief Destructor.
+     *
+     * The destructor is not virtual, so derived objects must not be deleted through this class.
+     */
+    ~ValueObject()
+    {
+    }
+
+    #endif // EOOS_CPP_STANDARD >= 2011
+
+};
+  
+} // namespace eoos
+#endif // VALUE_OBJECT_HPP_
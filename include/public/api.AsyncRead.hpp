@@ -0,0 +1,50 @@
+/**
+ * @file      api.AsyncRead.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef API_ASYNC_READ_HPP_
+#define API_ASYNC_READ_HPP_
+
+#include "api.Object.hpp"
+
+namespace eoos
+{
+namespace api
+{
+
+/**
+ * @class AsyncRead
+ * @brief Stream asynchronous read interface.
+ */        
+class AsyncRead : public Object
+{
+
+public:
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~AsyncRead() = 0;
+
+    /**
+     * @brief Queues reading data from a stream.
+     *
+     * The request is passed to the system on next submitting of a completion queue
+     * this interface was created by, and a number of read bytes is harvested from the queue.
+     * The data must not be accessed until the request is completed.
+     *
+     * @param data Pointer to data.
+     * @param size Size of data in Bytes.
+     * @param tag  A value to identify a completion of the request.
+     * @return True if the request is queued, or false if the queue is full.
+     */
+    virtual bool_t read(void* data, size_t size, int64_t tag) = 0;
+    
+};
+
+inline AsyncRead::~AsyncRead() {}
+
+} // namespace api
+} // namespace eoos
+#endif // API_ASYNC_READ_HPP_
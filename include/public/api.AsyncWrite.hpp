@@ -0,0 +1,50 @@
+/**
+ * @file      api.AsyncWrite.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef API_ASYNC_WRITE_HPP_
+#define API_ASYNC_WRITE_HPP_
+
+#include "api.Object.hpp"
+
+namespace eoos
+{
+namespace api
+{
+
+/**
+ * @class AsyncWrite
+ * @brief Stream asynchronous write interface.
+ */
+class AsyncWrite : public Object
+{
+
+public:
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~AsyncWrite() = 0;
+
+    /**
+     * @brief Queues writing data to a stream.
+     *
+     * The request is passed to the system on next submitting of a completion queue
+     * this interface was created by, and a number of written bytes is harvested from the queue.
+     * The data must not be changed until the request is completed.
+     *
+     * @param data Pointer to data.
+     * @param size Size of data in Bytes.
+     * @param tag  A value to identify a completion of the request.
+     * @return True if the request is queued, or false if the queue is full.
+     */
+    virtual bool_t write(const void* data, size_t size, int64_t tag) = 0;
+    
+};
+
+inline AsyncWrite::~AsyncWrite() {}
+
+} // namespace api
+} // namespace eoos
+#endif // API_ASYNC_WRITE_HPP_
@@ -0,0 +1,138 @@
+/**
+ * @file      api.Buffer.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef API_BUFFER_HPP_
+#define API_BUFFER_HPP_
+
+#include "api.Object.hpp"
+#include "api.Read.hpp"
+#include "api.Write.hpp"
+
+namespace eoos
+{
+namespace api
+{
+
+/**
+ * @class Buffer
+ * @brief Reference counted chain of buffer segments interface.
+ *
+ * The interface allows passing data from a read stream to a write stream
+ * through queues by handle, so that data is not copied between the stages.
+ * Segments of the chain have fixed size and are taken from a pool,
+ * and they are shared by buffers sliced from each other.
+ */
+class Buffer : public Object
+{
+
+public:
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Buffer() = 0;
+
+    /**
+     * @brief Adds a reference to this buffer.
+     *
+     * The method is called for each handle of this buffer being passed to a new owner, for instance,
+     * before adding the handle to a queue which consumer will release it.
+     */
+    virtual void retain() = 0;
+
+    /**
+     * @brief Removes a reference to this buffer.
+     *
+     * The last removed reference returns this buffer and its segments, if they are not shared
+     * with other buffers, to the pool. The buffer must not be accessed after the call by the caller.
+     */
+    virtual void release() = 0;
+
+    /**
+     * @brief Returns a number of data bytes in this buffer.
+     *
+     * @return Number of bytes.
+     */
+    virtual size_t getLength() const = 0;
+
+    /**
+     * @brief Returns segments containing data of this buffer.
+     *
+     * @param segments An array of segments to be filled.
+     * @param number   A number of elements of the array.
+     * @return Number of copied segments, or -1 if an error has been occurred.
+     */
+    virtual int32_t getSegments(Write::Segment* segments, int32_t number) const = 0;
+
+    /**
+     * @brief Takes segments from the pool to have free space at the end of this buffer.
+     *
+     * @param size Number of bytes of the free space required.
+     * @return True if the free space is available.
+     */
+    virtual bool_t reserve(size_t size) = 0;
+
+    /**
+     * @brief Returns segments of free space at the end of this buffer.
+     *
+     * @param segments An array of segments to be filled.
+     * @param number   A number of elements of the array.
+     * @return Number of copied segments, or -1 if an error has been occurred.
+     */
+    virtual int32_t getSpace(Read::Segment* segments, int32_t number) = 0;
+
+    /**
+     * @brief Appends bytes written to the free space to data of this buffer.
+     *
+     * @param size Number of bytes written.
+     * @return True if the bytes are appended.
+     */
+    virtual bool_t commit(size_t size) = 0;
+
+    /**
+     * @brief Removes bytes from the beginning of data of this buffer.
+     *
+     * Segments having no data any more are returned to the pool if they are not shared.
+     *
+     * @param size Number of bytes to be removed.
+     * @return True if the bytes are removed.
+     */
+    virtual bool_t consume(size_t size) = 0;
+
+    /**
+     * @brief Creates a buffer of a part of this buffer data.
+     *
+     * The new buffer shares segments with this buffer, so the data is not copied.
+     *
+     * @param offset Position of the first byte in this buffer data.
+     * @param size   Number of bytes.
+     * @return A new buffer, or NULLPTR if an error has been occurred.
+     */
+    virtual Buffer* slice(size_t offset, size_t size) = 0;
+
+    /**
+     * @brief Reads data from a stream to the end of this buffer.
+     *
+     * @param stream A stream to read from.
+     * @param size   Number of bytes to read.
+     * @return Number of read bytes.
+     */
+    virtual size_t fill(const Read& stream, size_t size) = 0;
+
+    /**
+     * @brief Writes data of this buffer to a stream and consumes written bytes.
+     *
+     * @param stream A stream to write to.
+     * @return Number of bytes written.
+     */
+    virtual size_t drain(Write& stream) = 0;
+
+};
+
+inline Buffer::~Buffer() {}
+
+} // namespace api
+} // namespace eoos
+#endif // API_BUFFER_HPP_
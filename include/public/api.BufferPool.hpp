@@ -0,0 +1,61 @@
+/**
+ * @file      api.BufferPool.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef API_BUFFER_POOL_HPP_
+#define API_BUFFER_POOL_HPP_
+
+#include "api.Object.hpp"
+#include "api.Buffer.hpp"
+
+namespace eoos
+{
+namespace api
+{
+
+/**
+ * @class BufferPool
+ * @brief Pool of fixed size buffer segments interface.
+ */
+class BufferPool : public Object
+{
+
+public:
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~BufferPool() = 0;
+
+    /**
+     * @brief Creates a new empty buffer.
+     *
+     * The buffer is created with one reference which must be released
+     * by the release method of the buffer, and not by the delete operator.
+     *
+     * @return A new buffer, or NULLPTR if an error has been occurred.
+     */
+    virtual Buffer* createBuffer() = 0;
+
+    /**
+     * @brief Returns size of segments of this pool.
+     *
+     * @return Segment size in bytes.
+     */
+    virtual size_t getSegmentSize() const = 0;
+
+    /**
+     * @brief Returns a number of free segments of this pool.
+     *
+     * @return Number of segments.
+     */
+    virtual int32_t getFreeSegments() const = 0;
+
+};
+
+inline BufferPool::~BufferPool() {}
+
+} // namespace api
+} // namespace eoos
+#endif // API_BUFFER_POOL_HPP_
@@ -0,0 +1,95 @@
+/**
+ * @file      api.CompletionQueue.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef API_COMPLETION_QUEUE_HPP_
+#define API_COMPLETION_QUEUE_HPP_
+
+#include "api.Object.hpp"
+#include "api.Read.hpp"
+#include "api.Write.hpp"
+#include "api.AsyncRead.hpp"
+#include "api.AsyncWrite.hpp"
+
+namespace eoos
+{
+namespace api
+{
+
+/**
+ * @class CompletionQueue
+ * @brief Asynchronous input and output completion queue interface.
+ *
+ * The interface collects read and write requests of streams, passes them
+ * to the system in batches, and returns their results through one queue,
+ * so that many requests cost one system call.
+ */
+class CompletionQueue : public Object
+{
+
+public:
+
+    /**
+     * @struct Completion
+     * @brief A result of a completed request.
+     */
+    struct Completion
+    {
+        /**
+         * @brief The tag passed with the request.
+         */
+        int64_t tag;
+
+        /**
+         * @brief Number of bytes read or written, or -1 if an error has been occurred.
+         */
+        int64_t result;
+    };
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~CompletionQueue() = 0;
+
+    /**
+     * @brief Creates an asynchronous variant of a read stream.
+     *
+     * @param stream A stream created by the system and backed by a file descriptor.
+     * @return A new asynchronous read interface, or NULLPTR if an error has been occurred.
+     */
+    virtual AsyncRead* createRead(Read& stream) = 0;
+
+    /**
+     * @brief Creates an asynchronous variant of a write stream.
+     *
+     * @param stream A stream created by the system and backed by a file descriptor.
+     * @return A new asynchronous write interface, or NULLPTR if an error has been occurred.
+     */
+    virtual AsyncWrite* createWrite(Write& stream) = 0;
+
+    /**
+     * @brief Passes all queued requests to the system.
+     *
+     * @return Number of submitted requests, or -1 if an error has been occurred.
+     */
+    virtual int32_t submit() = 0;
+
+    /**
+     * @brief Harvests results of completed requests.
+     *
+     * @param completions An array of completions to be filled.
+     * @param length      A number of elements of the array.
+     * @param timeout     A time to wait for at least one completion in nanoseconds,
+     *                    zero to return immediately, or -1 to wait infinitely.
+     * @return Number of harvested completions, or -1 if an error has been occurred.
+     */
+    virtual int32_t harvest(Completion* completions, int32_t length, int64_t timeout = 0) = 0;
+
+};
+
+inline CompletionQueue::~CompletionQueue() {}
+
+} // namespace api
+} // namespace eoos
+#endif // API_COMPLETION_QUEUE_HPP_
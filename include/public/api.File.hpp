@@ -0,0 +1,125 @@
+/**
+ * @file      api.File.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef API_FILE_HPP_
+#define API_FILE_HPP_
+
+#include "api.Read.hpp"
+#include "api.Write.hpp"
+
+namespace eoos
+{
+namespace api
+{
+
+/**
+ * @class File
+ * @brief File stream interface.
+ *
+ * The interface reads and writes a file from its current position. The file is mapped
+ * to memory if it is possible, so its content might be accessed directly without copying,
+ * otherwise reading and writing are performed at the position by system calls.
+ *
+ * @note The interface inherits the Object interface through the Read and Write
+ * interfaces, so a file is converted to Object through one of them.
+ */
+class File : public Read, public Write
+{
+
+public:
+
+    /**
+     * @enum Mode
+     * @brief File open modes.
+     */
+    enum Mode
+    {
+        MODE_READ       = 0, //< Opens an existing file for reading.
+        MODE_WRITE      = 1, //< Creates a file or truncates an existing one for writing.
+        MODE_READ_WRITE = 2  //< Opens an existing file for reading and writing.
+    };
+
+    /**
+     * @enum Advice
+     * @brief Expected file access patterns.
+     */
+    enum Advice
+    {
+        ADVICE_NORMAL     = 0, //< No specific access pattern.
+        ADVICE_SEQUENTIAL = 1, //< Content is accessed from lower to higher offsets.
+        ADVICE_RANDOM     = 2, //< Content is accessed in random order.
+        ADVICE_WILLNEED   = 3  //< Content will be accessed soon and should be read ahead.
+    };
+
+    /**
+     * @brief Buffer segment to read data to.
+     */
+    typedef Read::Segment ReadSegment;
+
+    /**
+     * @brief Buffer segment to write data from.
+     */
+    typedef Write::Segment WriteSegment;
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~File() = 0;
+
+    /**
+     * @brief Tests if this object has been constructed.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    virtual bool_t isConstructed() const = 0;
+
+    /**
+     * @brief Returns size of this file.
+     *
+     * @return Size in bytes, or -1 if an error has been occurred.
+     */
+    virtual int64_t getSize() const = 0;
+
+    /**
+     * @brief Returns current position of reading and writing.
+     *
+     * @return Offset in bytes from the beginning of this file, or -1 if an error has been occurred.
+     */
+    virtual int64_t getPosition() const = 0;
+
+    /**
+     * @brief Sets current position of reading and writing.
+     *
+     * @param position Offset in bytes from the beginning of this file.
+     * @return True if the position is set.
+     */
+    virtual bool_t setPosition(int64_t position) = 0;
+
+    /**
+     * @brief Returns content of this file mapped to memory.
+     *
+     * @note The returned address is actual until this file is resized or destroyed.
+     *
+     * @return Address of the first byte of this file, or NULLPTR if this file is not mapped.
+     */
+    virtual void* getData() const = 0;
+
+    /**
+     * @brief Advises the system of a pattern of accessing a part of this file.
+     *
+     * @param advice   An access pattern.
+     * @param position Offset in bytes of the part from the beginning of this file.
+     * @param size     Size of the part in bytes, or zero till the end of this file.
+     * @return True if the advice is accepted.
+     */
+    virtual bool_t advise(Advice advice, int64_t position = 0, int64_t size = 0) = 0;
+
+};
+
+inline File::~File() {}
+
+} // namespace api
+} // namespace eoos
+#endif // API_FILE_HPP_
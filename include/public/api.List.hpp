@@ -32,6 +32,13 @@ public:
      */
     virtual ~List() = 0;
 
+    /**
+     * @brief Tests if this object has been constructed.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    virtual bool_t isConstructed() const = 0;
+
     /**
      * @brief Inserts new element to the end of this container.
      *
@@ -57,6 +64,63 @@ public:
      */
     virtual bool_t add(int32_t index, const T& element) = 0;
 
+    #if EOOS_CPP_STANDARD >= 2011
+
+    /**
+     * @brief Inserts new element to the end of this container.
+     *
+     * @note A passed element must be moved to an internal data structure of
+     * a realizing class by calling a move constructor so that the element
+     * might be invalidated after the function called.
+     *
+     * @param element An inserting element.
+     * @return True if element is added.
+     */
+    virtual bool_t add(T&& element) = 0;
+
+    /**
+     * @brief Inserts new element to the specified position in this container.
+     *
+     * @note A passed element must be moved to an internal data structure of
+     * a realizing class by calling a move constructor so that the element
+     * might be invalidated after the function called.
+     *
+     * @param index   A position in this container.
+     * @param element An inserting element.
+     * @return True if element is inserted.
+     */
+    virtual bool_t add(int32_t index, T&& element) = 0;
+
+    /**
+     * @brief Constructs new element at the end of this container.
+     *
+     * The element is constructed of given arguments and moved to this container.
+     *
+     * @param args Arguments of a constructor of the element.
+     * @return True if element is added.
+     */
+    template <typename... Args>
+    bool_t emplace(Args&&... args)
+    {
+        T element(static_cast<Args&&>(args)...);
+        return add( static_cast<T&&>(element) );
+    }
+
+    #endif // EOOS_CPP_STANDARD >= 2011
+
+    /**
+     * @brief Inserts new elements to the end of this container.
+     *
+     * @note Passed elements must be copied to an internal data structure of
+     * a realizing class, and elements of trivially copyable types should be
+     * copied by one memory copy.
+     *
+     * @param elements An array of inserting elements.
+     * @param number   A number of elements of the array.
+     * @return True if all the elements are added, or false if no elements are added.
+     */
+    virtual bool_t addAll(const T* elements, int32_t number) = 0;
+
     /**
      * @brief Removes all elements from this container.
      */
@@ -92,6 +156,18 @@ public:
      */
     virtual bool_t removeElement(const T& element) = 0;
 
+    /**
+     * @brief Removes elements in the specified range of positions in this container.
+     *
+     * @note Elements of trivially copyable types following the range should be
+     * shifted by one memory move.
+     *
+     * @param from The first position of the range.
+     * @param to   The position following the last position of the range.
+     * @return True if the elements are removed successfully.
+     */
+    virtual bool_t removeRange(int32_t from, int32_t to) = 0;
+
     /**
      * @brief Returns an element from this container by index.
      *
@@ -141,6 +217,17 @@ public:
      */
     virtual bool_t isIndex(int32_t index) const = 0;
 
+    /**
+     * @brief Copies elements from the beginning of this container to an array.
+     *
+     * @note Elements of trivially copyable types should be copied by one memory copy.
+     *
+     * @param elements An array to copy elements to.
+     * @param number   A number of elements of the array.
+     * @return Number of copied elements, or -1 if an error has been occurred.
+     */
+    virtual int32_t copyTo(T* elements, int32_t number) const = 0;
+
 };
 
 template <typename T>
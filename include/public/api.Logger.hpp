@@ -0,0 +1,258 @@
+/**
+ * @file      api.Logger.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef API_LOGGER_HPP_
+#define API_LOGGER_HPP_
+
+#include "api.Object.hpp"
+
+namespace eoos
+{
+namespace api
+{
+
+/**
+ * @class Logger
+ * @brief Deferred formatting logger interface.
+ *
+ * The interface records an identifier of a format string and raw arguments
+ * to a ring buffer of current thread, and a background thread formats the records
+ * and writes them to a sink later, so logging does not format and write text in
+ * context of a caller. A format string is registered once and contains
+ * the {} sequence in place of each argument.
+ */
+class Logger : public Object
+{
+
+public:
+
+    /**
+     * @enum Type
+     * @brief Types of arguments.
+     */
+    enum Type
+    {
+        TYPE_INT32   = 0, //< Signed 32-bit integer.
+        TYPE_UINT32  = 1, //< Unsigned 32-bit integer.
+        TYPE_INT64   = 2, //< Signed 64-bit integer.
+        TYPE_UINT64  = 3, //< Unsigned 64-bit integer.
+        TYPE_FLOAT32 = 4, //< Single precision floating point number.
+        TYPE_FLOAT64 = 5, //< Double precision floating point number.
+        TYPE_LITERAL = 6  //< String literal which is never destroyed.
+    };
+
+    /**
+     * @struct Argument
+     * @brief A raw argument of a record.
+     */
+    struct Argument
+    {
+        /**
+         * @brief Constructor.
+         *
+         * Integers are taken by the standard types, which are distinct types for any data
+         * model unlike fixed width types, so any integer argument has an exact constructor.
+         *
+         * @param arg An argument value.
+         */
+        Argument(signed int const arg) :
+            type (TYPE_INT32){
+            value.i = static_cast<int64_t>(arg);
+        }
+
+        /**
+         * @copydoc eoos::api::Logger::Argument::Argument(signed int)
+         */
+        Argument(unsigned int const arg) :
+            type (TYPE_UINT32){
+            value.u = static_cast<uint64_t>(arg);
+        }
+
+        /**
+         * @copydoc eoos::api::Logger::Argument::Argument(signed int)
+         */
+        Argument(signed long const arg) :
+            type ((sizeof(signed long) > 4U) ? TYPE_INT64 : TYPE_INT32){
+            value.i = static_cast<int64_t>(arg);
+        }
+
+        /**
+         * @copydoc eoos::api::Logger::Argument::Argument(signed int)
+         */
+        Argument(unsigned long const arg) :
+            type ((sizeof(unsigned long) > 4U) ? TYPE_UINT64 : TYPE_UINT32){
+            value.u = static_cast<uint64_t>(arg);
+        }
+
+        /**
+         * @copydoc eoos::api::Logger::Argument::Argument(signed int)
+         */
+        Argument(signed long long const arg) :
+            type (TYPE_INT64){
+            value.i = static_cast<int64_t>(arg);
+        }
+
+        /**
+         * @copydoc eoos::api::Logger::Argument::Argument(signed int)
+         */
+        Argument(unsigned long long const arg) :
+            type (TYPE_UINT64){
+            value.u = static_cast<uint64_t>(arg);
+        }
+
+        /**
+         * @copydoc eoos::api::Logger::Argument::Argument(signed int)
+         */
+        Argument(float32_t const arg) :
+            type (TYPE_FLOAT32){
+            value.f = static_cast<float64_t>(arg);
+        }
+
+        /**
+         * @copydoc eoos::api::Logger::Argument::Argument(signed int)
+         */
+        Argument(float64_t const arg) :
+            type (TYPE_FLOAT64){
+            value.f = arg;
+        }
+
+        /**
+         * @copydoc eoos::api::Logger::Argument::Argument(signed int)
+         */
+        Argument(const char_t* const arg) :
+            type (TYPE_LITERAL){
+            value.s = arg;
+        }
+
+        /**
+         * @brief Type of the argument.
+         */
+        Type type;
+
+        /**
+         * @brief Value of the argument.
+         */
+        union
+        {
+            int64_t i;
+            uint64_t u;
+            float64_t f;
+            const char_t* s;
+        } value;
+    };
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Logger() = 0;
+
+    /**
+     * @brief Registers a format string.
+     *
+     * @param format A format string literal which is never destroyed.
+     * @return The format identifier, or -1 if an error has been occurred.
+     */
+    virtual int32_t addFormat(const char_t* format) = 0;
+
+    /**
+     * @brief Records a format identifier and an array of arguments.
+     *
+     * The function is named other than the log functions, so an implementation
+     * overriding it does not hide them, and they never take an array for arguments.
+     *
+     * @param format A format identifier.
+     * @param args   An array of arguments.
+     * @param number A number of elements of the array.
+     * @return True if the record is put to the ring buffer, or false if the buffer is full.
+     */
+    virtual bool_t record(int32_t format, const Argument* args, int32_t number) = 0;
+
+    /**
+     * @brief Returns a number of records lost as ring buffers were full.
+     *
+     * @return Number of records.
+     */
+    virtual int64_t getLost() const = 0;
+
+    /**
+     * @brief Waits for all records put before the call to be written.
+     */
+    virtual void flush() = 0;
+
+    /**
+     * @brief Records a format identifier.
+     *
+     * @param format A format identifier.
+     * @return True if the record is put to the ring buffer, or false if the buffer is full.
+     */
+    bool_t log(int32_t const format)
+    {
+        return record(format, NULLPTR, 0);
+    }
+
+    /**
+     * @brief Records a format identifier and arguments.
+     *
+     * @param format A format identifier.
+     * @param a0     The first argument.
+     * @return True if the record is put to the ring buffer, or false if the buffer is full.
+     */
+    bool_t log(int32_t const format, Argument const& a0)
+    {
+        return record(format, &a0, 1);
+    }
+
+    /**
+     * @brief Records a format identifier and arguments.
+     *
+     * @param format A format identifier.
+     * @param a0     The first argument.
+     * @param a1     The second argument.
+     * @return True if the record is put to the ring buffer, or false if the buffer is full.
+     */
+    bool_t log(int32_t const format, Argument const& a0, Argument const& a1)
+    {
+        Argument const args[] = {a0, a1};
+        return record(format, args, 2);
+    }
+
+    /**
+     * @brief Records a format identifier and arguments.
+     *
+     * @param format A format identifier.
+     * @param a0     The first argument.
+     * @param a1     The second argument.
+     * @param a2     The third argument.
+     * @return True if the record is put to the ring buffer, or false if the buffer is full.
+     */
+    bool_t log(int32_t const format, Argument const& a0, Argument const& a1, Argument const& a2)
+    {
+        Argument const args[] = {a0, a1, a2};
+        return record(format, args, 3);
+    }
+
+    /**
+     * @brief Records a format identifier and arguments.
+     *
+     * @param format A format identifier.
+     * @param a0     The first argument.
+     * @param a1     The second argument.
+     * @param a2     The third argument.
+     * @param a3     The fourth argument.
+     * @return True if the record is put to the ring buffer, or false if the buffer is full.
+     */
+    bool_t log(int32_t const format, Argument const& a0, Argument const& a1, Argument const& a2, Argument const& a3)
+    {
+        Argument const args[] = {a0, a1, a2, a3};
+        return record(format, args, 4);
+    }
+
+};
+
+inline Logger::~Logger() {}
+
+} // namespace api
+} // namespace eoos
+#endif // API_LOGGER_HPP_
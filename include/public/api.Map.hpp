@@ -0,0 +1,93 @@
+/**
+ * @file      api.Map.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef API_MAP_HPP_
+#define API_MAP_HPP_
+
+#include "api.Collection.hpp"
+#include "api.IllegalValue.hpp"
+
+namespace eoos
+{
+namespace api
+{
+
+/**
+ * @class Map<K,V>
+ * @brief Map interface.
+ *
+ * @tparam K Data type of map key.
+ * @tparam V Data type of map value.
+ */
+template <typename K, typename V>
+class Map : public Collection<V>, public IllegalValue<V>
+{
+
+public:
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Map() = 0;
+
+    /**
+     * @brief Tests if this object has been constructed.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    virtual bool_t isConstructed() const = 0;
+
+    /**
+     * @brief Associates a value with a key in this container.
+     *
+     * If the container has contained the key, its old value is replaced.
+     *
+     * @note A passed key and value must be copied to an internal data structure of
+     * a realizing class by calling a copy constructor so that they might be
+     * invalidated after the function called.
+     *
+     * @param key   A key.
+     * @param value A value associated with the key.
+     * @return True if the value is associated.
+     */
+    virtual bool_t set(const K& key, const V& value) = 0;
+
+    /**
+     * @brief Removes a key and its value from this container.
+     *
+     * @param key A key.
+     * @return True if the key is removed successfully.
+     */
+    virtual bool_t remove(const K& key) = 0;
+
+    /**
+     * @brief Removes all keys and values from this container.
+     */
+    virtual void clear() = 0;
+
+    /**
+     * @brief Returns a value associated with a key.
+     *
+     * @param key A key.
+     * @return The value, or the illegal value if this container does not contain the key.
+     */
+    virtual V& get(const K& key) const = 0;
+
+    /**
+     * @brief Tests if this container contains a key.
+     *
+     * @param key A key.
+     * @return True if the key is contained.
+     */
+    virtual bool_t isKey(const K& key) const = 0;
+
+};
+
+template <typename K, typename V>
+inline Map<K,V>::~Map() {}
+
+} // namespace api
+} // namespace eoos
+#endif // API_MAP_HPP_
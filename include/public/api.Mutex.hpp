@@ -22,6 +22,22 @@ class Mutex : public Object
 
 public:
 
+    /**
+     * @enum Protocol
+     * @brief Mutex priority protocols.
+     *
+     * Mutex protocols bounding priority inversion:
+     * - No protocol does not change priority of a thread owning a mutex.
+     * - Inheritance raises priority of an owner to the highest priority of threads waiting for a mutex.
+     * - Protection raises priority of an owner to a ceiling priority of a mutex while it is owned.
+     */
+    enum Protocol
+    {
+        PROTOCOL_NONE    = 0, //< No priority protocol.
+        PROTOCOL_INHERIT = 1, //< Priority inheritance.
+        PROTOCOL_PROTECT = 2  //< Priority ceiling.
+    };
+
     /**
      * @brief Destructor.
      */
@@ -46,6 +62,20 @@ public:
      */
     virtual void unlock() = 0;
 
+    /**
+     * @brief Returns a priority protocol of this mutex.
+     *
+     * @return The priority protocol.
+     */
+    virtual Protocol getProtocol() const = 0;
+
+    /**
+     * @brief Returns a ceiling priority of this mutex.
+     *
+     * @return Priority value, or Thread::PRIORITY_WRONG if this mutex protocol is not PROTOCOL_PROTECT.
+     */
+    virtual int32_t getCeiling() const = 0;
+
 };
 
 inline Mutex::~Mutex() {}
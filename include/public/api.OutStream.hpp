@@ -39,6 +39,28 @@ public:
      */
     virtual OutStream<T>& operator<<(const T* source) = 0;
 
+    /**
+     * @brief Writes characters to an output stream.
+     *
+     * The characters are not required to be terminated, so a caller knowing
+     * the length does not make the stream to search for the terminating character.
+     *
+     * @param source A source array of characters to be output.
+     * @param length Number of characters of the array.
+     * @return This interface.
+     */
+    virtual OutStream<T>& write(const T* source, int32_t length) = 0;
+
+    /**
+     * @brief Flushes this stream.
+     *
+     * A buffered stream writes all buffered characters to its sink,
+     * and a not buffered stream returns at once.
+     *
+     * @return This interface.
+     */
+    virtual OutStream<T>& flush() = 0;
+
 };
 
 template <typename T>
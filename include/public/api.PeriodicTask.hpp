@@ -0,0 +1,67 @@
+/**
+ * @file      api.PeriodicTask.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef API_PERIODIC_TASK_HPP_
+#define API_PERIODIC_TASK_HPP_
+
+#include "api.Task.hpp"
+
+namespace eoos
+{
+namespace api
+{
+    
+/**
+ * @class PeriodicTask
+ * @brief Periodic task interface.
+ *
+ * The interface of a task that is being released every period and
+ * scheduled by the earliest deadline first policy. The start method
+ * is invoked once for each period, and a non-zero returned value stops
+ * the thread with the value set as the execution error.
+ */        
+class PeriodicTask : public Task
+{
+
+public:
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~PeriodicTask() = 0;
+
+    /**
+     * @brief Returns a period of the task releases.
+     *
+     * @return Period in nanoseconds.
+     */
+    virtual int64_t getPeriod() const = 0;
+
+    /**
+     * @brief Returns a relative deadline of the task.
+     *
+     * The deadline is counted from the release time of each period
+     * and must not be greater than the period.
+     *
+     * @return Deadline in nanoseconds.
+     */
+    virtual int64_t getDeadline() const = 0;
+
+    /**
+     * @brief Returns a worst case execution time of the task for one period.
+     *
+     * The scheduler uses the time for admission control of the task.
+     *
+     * @return Execution time in nanoseconds.
+     */
+    virtual int64_t getRuntime() const = 0;
+
+};
+
+inline PeriodicTask::~PeriodicTask() {}
+        
+} // namespace api
+} // namespace eoos
+#endif // API_PERIODIC_TASK_HPP_
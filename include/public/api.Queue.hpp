@@ -50,6 +50,50 @@ public:
      */
     virtual bool_t add(const T& element) = 0;
 
+    #if EOOS_CPP_STANDARD >= 2011
+
+    /**
+     * @brief Inserts a new element to this container.
+     *
+     * @note A passed element must be moved to an internal data structure of
+     * a realizing class by calling a move constructor so that the element
+     * might be invalidated after the function called.
+     *
+     * @param element An inserting element.
+     * @return True if element is added.
+     */
+    virtual bool_t add(T&& element) = 0;
+
+    /**
+     * @brief Constructs a new element in this container.
+     *
+     * The element is constructed of given arguments and moved to this container.
+     *
+     * @param args Arguments of a constructor of the element.
+     * @return True if element is added.
+     */
+    template <typename... Args>
+    bool_t emplace(Args&&... args)
+    {
+        T element(static_cast<Args&&>(args)...);
+        return add( static_cast<T&&>(element) );
+    }
+
+    #endif // EOOS_CPP_STANDARD >= 2011
+
+    /**
+     * @brief Inserts new elements to the end of this container.
+     *
+     * @note Passed elements must be copied to an internal data structure of
+     * a realizing class, and elements of trivially copyable types should be
+     * copied by one memory copy.
+     *
+     * @param elements An array of inserting elements.
+     * @param number   A number of elements of the array.
+     * @return True if all the elements are added, or false if no elements are added.
+     */
+    virtual bool_t addAll(const T* elements, int32_t number) = 0;
+
     /**
      * @brief Removes the head element of this container.
      *
@@ -64,6 +108,17 @@ public:
      */
     virtual T& peek() const = 0;
 
+    /**
+     * @brief Copies elements from the beginning of this container to an array.
+     *
+     * @note Elements of trivially copyable types should be copied by one memory copy.
+     *
+     * @param elements An array to copy elements to.
+     * @param number   A number of elements of the array.
+     * @return Number of copied elements, or -1 if an error has been occurred.
+     */
+    virtual int32_t copyTo(T* elements, int32_t number) const = 0;
+
 };
 
 template <typename T>
@@ -0,0 +1,115 @@
+/**
+ * @file      api.Reactor.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ */
+#ifndef API_REACTOR_HPP_
+#define API_REACTOR_HPP_
+
+#include "api.Object.hpp"
+#include "api.Read.hpp"
+#include "api.Write.hpp"
+#include "api.Task.hpp"
+#include "api.Queue.hpp"
+
+namespace eoos
+{
+namespace api
+{
+
+/**
+ * @class Reactor
+ * @brief Stream readiness multiplexer interface.
+ *
+ * The interface allows one thread to serve many streams. A registered stream
+ * is switched to non-blocking mode, so its read and write methods return
+ * a number of bytes less than requested instead of waiting, and a handler
+ * task of a stream is started when the stream becomes ready.
+ */
+class Reactor : public Object
+{
+
+public:
+
+    /**
+     * @enum Trigger
+     * @brief Readiness notification modes.
+     *
+     * Notification modes:
+     * - Level triggered handlers are started while a stream is ready.
+     * - Edge triggered handlers are started once a stream becomes ready,
+     *   therefore a handler has to read or write a stream until it returns less bytes than requested.
+     */
+    enum Trigger
+    {
+        TRIGGER_LEVEL = 0, //< Level triggered notification.
+        TRIGGER_EDGE  = 1  //< Edge triggered notification.
+    };
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Reactor() = 0;
+
+    /**
+     * @brief Registers a stream for reading.
+     *
+     * @param stream  A stream created by the system and backed by a file descriptor.
+     * @param handler A task which start method will be invoked when the stream is ready for reading.
+     * @param trigger A notification mode.
+     * @return True if the stream is registered, or false if the stream is not backed by a descriptor.
+     */
+    virtual bool_t add(Read& stream, Task& handler, Trigger trigger = TRIGGER_LEVEL) = 0;
+
+    /**
+     * @brief Registers a stream for writing.
+     *
+     * @param stream  A stream created by the system and backed by a file descriptor.
+     * @param handler A task which start method will be invoked when the stream is ready for writing.
+     * @param trigger A notification mode.
+     * @return True if the stream is registered, or false if the stream is not backed by a descriptor.
+     */
+    virtual bool_t add(Write& stream, Task& handler, Trigger trigger = TRIGGER_LEVEL) = 0;
+
+    /**
+     * @brief Unregisters a stream for reading.
+     *
+     * @param stream A registered stream.
+     * @return True if the stream is unregistered.
+     */
+    virtual bool_t remove(Read& stream) = 0;
+
+    /**
+     * @brief Unregisters a stream for writing.
+     *
+     * @param stream A registered stream.
+     * @return True if the stream is unregistered.
+     */
+    virtual bool_t remove(Write& stream) = 0;
+
+    /**
+     * @brief Waits for ready streams and starts their handlers in context of current thread.
+     *
+     * @param timeout A time to wait in nanoseconds, zero to return immediately, or -1 to wait infinitely.
+     * @return Number of started handlers, or -1 if an error has been occurred.
+     */
+    virtual int32_t dispatch(int64_t timeout = -1) = 0;
+
+    /**
+     * @brief Waits for ready streams and adds their handlers to a work queue.
+     *
+     * The method allows worker threads to start the handlers taken from the queue.
+     *
+     * @param queue   A queue of handlers to be started.
+     * @param timeout A time to wait in nanoseconds, zero to return immediately, or -1 to wait infinitely.
+     * @return Number of added handlers, or -1 if an error has been occurred.
+     */
+    virtual int32_t dispatch(Queue<Task*>& queue, int64_t timeout = -1) = 0;
+
+};
+
+inline Reactor::~Reactor() {}
+
+} // namespace api
+} // namespace eoos
+#endif // API_REACTOR_HPP_
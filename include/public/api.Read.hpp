@@ -22,6 +22,23 @@ class Read : public Object
 
 public:
 
+    /**
+     * @struct Segment
+     * @brief A buffer segment to read data to.
+     */
+    struct Segment
+    {
+        /**
+         * @brief Pointer to data.
+         */
+        void* data;
+
+        /**
+         * @brief Size of data in Bytes.
+         */
+        size_t size;
+    };
+
     /**
      * @brief Destructor.
      */
@@ -35,7 +52,47 @@ public:
      * @return Number of read bytes.
      */
     virtual size_t read(void* data, size_t size) const = 0;
-    
+
+    /**
+     * @brief Reads data from a stream to several buffer segments.
+     *
+     * The segments are filled in order, and reading stops on a segment which
+     * is not filled entirely. A stream backed by a file descriptor should read
+     * all the segments by one system call, and other streams might forward to readEach().
+     *
+     * @param segments An array of buffer segments.
+     * @param number   A number of elements of the array.
+     * @return Number of read bytes.
+     */
+    virtual size_t readSegments(const Segment* segments, int32_t number) const = 0;
+
+protected:
+
+    /**
+     * @brief Reads data to several buffer segments by one call for each segment.
+     *
+     * @param segments An array of buffer segments.
+     * @param number   A number of elements of the array.
+     * @return Number of read bytes.
+     */
+    size_t readEach(const Segment* const segments, int32_t const number) const
+    {
+        size_t res = 0;
+        if(segments != NULLPTR)
+        {
+            for(int32_t i = 0; i < number; i++)
+            {
+                size_t const size = read(segments[i].data, segments[i].size);
+                res += size;
+                if(size != segments[i].size)
+                {
+                    break;
+                }
+            }
+        }
+        return res;
+    }
+
 };
 
 inline Read::~Read() {}
@@ -9,6 +9,7 @@
 #include "api.Object.hpp"
 #include "api.Thread.hpp"
 #include "api.Task.hpp"
+#include "api.PeriodicTask.hpp"
 #include "api.Toggle.hpp"
 
 namespace eoos
@@ -37,6 +38,17 @@ public:
      * @return A new thread.
      */
     virtual Thread* createThread(Task& task) = 0;
+
+    /**
+     * @brief Creates a new thread scheduled by the earliest deadline first policy.
+     *
+     * The thread is admitted if the total utilization of the CPU by all periodic threads
+     * including the new one, which is a sum of their runtime to period ratios, does not exceed one.
+     *
+     * @param task An user task which main method will be invoked every period when created thread is started.
+     * @return A new thread, or NULLPTR if the task has not been admitted or an error has been occurred.
+     */
+    virtual Thread* createThread(PeriodicTask& task) = 0;
     
     /**
      * @brief Causes current thread to sleep.
@@ -46,11 +58,33 @@ public:
      */
     virtual void sleep(int64_t millis, int32_t nanos = 0) = 0;    
 
+    /**
+     * @brief Causes current thread to sleep until given time.
+     *
+     * The time is absolute, so sleeping of periodic loops does not drift by the time of their execution.
+     * If given time has already passed, the method returns immediately.
+     *
+     * @param time An absolute time in nanoseconds of the system running time returned by System::getTime().
+     */
+    virtual void sleepUntil(int64_t time) = 0;
+
     /**
      * @brief Yields to next thread.
      */
     virtual void yield() = 0;
 
+    /**
+     * @brief Samples threads of this scheduler.
+     *
+     * The method copies pointers to threads which are not dead at the moment of
+     * the call to a given array, so their statistics might be read further.
+     *
+     * @param threads An array of pointers to threads to be filled.
+     * @param length  A number of elements of the array.
+     * @return Number of copied threads, or -1 if an error has been occurred.
+     */
+    virtual int32_t getThreads(Thread** threads, int32_t length) const = 0;
+
 };
 
 inline Scheduler::~Scheduler() {}
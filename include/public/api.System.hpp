@@ -14,6 +14,13 @@
 #include "api.Semaphore.hpp"
 #include "api.Task.hpp"
 #include "api.Toggle.hpp"
+#include "api.Reactor.hpp"
+#include "api.CompletionQueue.hpp"
+#include "api.BufferPool.hpp"
+#include "api.OutStream.hpp"
+#include "api.Write.hpp"
+#include "api.Logger.hpp"
+#include "api.File.hpp"
 
 namespace eoos
 {
@@ -29,6 +36,21 @@ class System : public Object
 
 public:
 
+    /**
+     * @enum Phase
+     * @brief System startup phases.
+     *
+     * Subsystems are constructed on their first use, so phases
+     * of subsystems a program does not use are never passed.
+     */
+    enum Phase
+    {
+        PHASE_BOOT      = 0, //< Bring-up of the system till the main program is started.
+        PHASE_HEAP      = 1, //< Construction of the heap memory.
+        PHASE_SCHEDULER = 2, //< Construction of the kernel scheduler.
+        PHASE_RESOURCES = 3  //< Construction of mutex and semaphore resources factories.
+    };
+
     /**
      * @brief Returns running time of the system in nanoseconds.
      *
@@ -36,6 +58,14 @@ public:
      */
     virtual int64_t getTime() const = 0;
 
+    /**
+     * @brief Returns time the system has spent on a startup phase.
+     *
+     * @param phase A startup phase.
+     * @return Time in nanoseconds, or -1 if the phase has not been passed.
+     */
+    virtual int64_t getPhaseTime(Phase phase) const = 0;
+
     /**
      * @brief Returns the system heap memory.
      *
@@ -57,6 +87,16 @@ public:
      */
     virtual Mutex* createMutex() = 0;
 
+    /**
+     * @brief Creates a new mutex resource with given priority protocol.
+     *
+     * @param protocol A priority protocol of the mutex.
+     * @param ceiling  A ceiling priority in range [Thread::PRIORITY_MIN, Thread::PRIORITY_MAX], or
+     *                 Thread::PRIORITY_LOCK for PROTOCOL_PROTECT, otherwise the value is ignored.
+     * @return A new mutex resource, or NULLPTR if an error has been occurred.
+     */
+    virtual Mutex* createMutex(Mutex::Protocol protocol, int32_t ceiling = Thread::PRIORITY_WRONG) = 0;
+
     /**
      * @brief Creates a new semaphore resource.
      *
@@ -65,6 +105,65 @@ public:
      * @return A new semaphore resource, or NULLPTR if an error has been occurred.
      */
     virtual Semaphore* createSemaphore(int32_t permits, bool_t isFair) = 0;
+
+    /**
+     * @brief Creates a new stream readiness multiplexer.
+     *
+     * @return A new reactor resource, or NULLPTR if an error has been occurred.
+     */
+    virtual Reactor* createReactor() = 0;
+
+    /**
+     * @brief Creates a new asynchronous input and output completion queue.
+     *
+     * @param depth A maximum number of requests being queued and executed at the same time.
+     * @return A new completion queue resource, or NULLPTR if an error has been occurred.
+     */
+    virtual CompletionQueue* createCompletionQueue(int32_t depth) = 0;
+
+    /**
+     * @brief Creates a new pool of buffer segments.
+     *
+     * @param size   Size of each segment in bytes.
+     * @param number A number of segments of the pool.
+     * @return A new buffer pool resource, or NULLPTR if an error has been occurred.
+     */
+    virtual BufferPool* createBufferPool(size_t size, int32_t number) = 0;
+
+    /**
+     * @brief Creates a new buffered output stream.
+     *
+     * Each thread outputs characters to its own buffer without locking,
+     * and a buffer is written to the sink by one call when it has no space
+     * for a next line or when the stream is flushed. A line is never split
+     * between writes, so lines of different threads are not interleaved.
+     *
+     * @param sink A stream to write characters to.
+     * @param size Size of each thread buffer in bytes.
+     * @return A new output stream resource, or NULLPTR if an error has been occurred.
+     */
+    virtual OutStream<char_t>* createOutStream(Write& sink, size_t size) = 0;
+
+    /**
+     * @brief Creates a new deferred formatting logger.
+     *
+     * The logger creates a thread by the kernel scheduler, which formats
+     * records of all threads and writes them to the sink.
+     *
+     * @param sink A stream to write formatted records to.
+     * @param size Size of each thread ring buffer in bytes.
+     * @return A new logger resource, or NULLPTR if an error has been occurred.
+     */
+    virtual Logger* createLogger(Write& sink, size_t size) = 0;
+
+    /**
+     * @brief Opens a file.
+     *
+     * @param path A system path to a file.
+     * @param mode A file open mode.
+     * @return A new file resource, or NULLPTR if an error has been occurred.
+     */
+    virtual File* createFile(const char_t* path, File::Mode mode) = 0;
     
 protected:
 
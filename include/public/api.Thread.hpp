@@ -122,6 +122,51 @@ public:
      */
     virtual int32_t getExecutionError() const = 0;
 
+    /**
+     * @brief Returns time of this thread being executed on CPU.
+     *
+     * @return Cumulative CPU time in nanoseconds, or -1 if an error has been occurred.
+     */
+    virtual int64_t getCpuTime() const = 0;
+
+    /**
+     * @brief Returns time of this thread being blocked on resources.
+     *
+     * @return Cumulative time in nanoseconds of the STATUS_BLOCKED status, or -1 if an error has been occurred.
+     */
+    virtual int64_t getBlockedTime() const = 0;
+
+    /**
+     * @brief Returns time of this thread sleeping.
+     *
+     * @return Cumulative time in nanoseconds of the STATUS_SLEEPING status, or -1 if an error has been occurred.
+     */
+    virtual int64_t getSleepingTime() const = 0;
+
+    /**
+     * @brief Returns a number of context switches this thread gave up CPU itself.
+     *
+     * The switches are caused by blocking, sleeping or yielding of this thread.
+     *
+     * @return Number of voluntary context switches, or -1 if an error has been occurred.
+     */
+    virtual int64_t getVoluntarySwitches() const = 0;
+
+    /**
+     * @brief Returns a number of context switches this thread was preempted.
+     *
+     * @return Number of involuntary context switches, or -1 if an error has been occurred.
+     */
+    virtual int64_t getInvoluntarySwitches() const = 0;
+
+    /**
+     * @brief Returns a number of deadlines missed by this thread.
+     *
+     * @return Number of periods this thread has not completed before its deadline,
+     *         zero for a thread of not periodic task, or -1 if an error has been occurred.
+     */
+    virtual int64_t getMissedDeadlines() const = 0;
+
 };
 
 inline Thread::~Thread() {}
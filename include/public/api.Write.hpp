@@ -22,6 +22,23 @@ class Write : public Object
 
 public:
 
+    /**
+     * @struct Segment
+     * @brief A buffer segment to write data from.
+     */
+    struct Segment
+    {
+        /**
+         * @brief Pointer to data.
+         */
+        const void* data;
+
+        /**
+         * @brief Size of data in Bytes.
+         */
+        size_t size;
+    };
+
     /**
      * @brief Destructor.
      */
@@ -35,7 +52,47 @@ public:
      * @return Number of bytes written.
      */
     virtual size_t write(const void* data, size_t size) = 0;
-    
+
+    /**
+     * @brief Writes data of several buffer segments to a stream.
+     *
+     * The segments are written in order, and writing stops on a segment which
+     * is not written entirely. A stream backed by a file descriptor should write
+     * all the segments by one system call, and other streams might forward to writeEach().
+     *
+     * @param segments An array of buffer segments.
+     * @param number   A number of elements of the array.
+     * @return Number of bytes written.
+     */
+    virtual size_t writeSegments(const Segment* segments, int32_t number) = 0;
+
+protected:
+
+    /**
+     * @brief Writes data of several buffer segments by one call for each segment.
+     *
+     * @param segments An array of buffer segments.
+     * @param number   A number of elements of the array.
+     * @return Number of written bytes.
+     */
+    size_t writeEach(const Segment* const segments, int32_t const number)
+    {
+        size_t res = 0;
+        if(segments != NULLPTR)
+        {
+            for(int32_t i = 0; i < number; i++)
+            {
+                size_t const size = write(segments[i].data, segments[i].size);
+                res += size;
+                if(size != segments[i].size)
+                {
+                    break;
+                }
+            }
+        }
+        return res;
+    }
+
 };
 
 inline Write::~Write() {}
@@ -0,0 +1,492 @@
+/**
+ * @file      Formatter.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2021, Sergey Baigudin, Baigudin Software
+ *
+ * @brief Floating point numbers are formatted by the Grisu2 algorithm of Florian Loitsch.
+ */ 
+#include <cstring>
+#include "Formatter.hpp"
+
+namespace eoos
+{
+
+namespace
+{
+
+/**
+ * @brief Two digit characters of numbers from 0 to 99.
+ */
+const char_t DIGIT_PAIRS[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+/**
+ * @brief Significands of normalized powers of ten from 10^-348 to 10^340 with step 8.
+ */
+const uint64_t POWERS_F[] = {
+    0xfa8fd5a0081c0288ULL, 0xbaaee17fa23ebf76ULL, 0x8b16fb203055ac76ULL,
+    0xcf42894a5dce35eaULL, 0x9a6bb0aa55653b2dULL, 0xe61acf033d1a45dfULL,
+    0xab70fe17c79ac6caULL, 0xff77b1fcbebcdc4fULL, 0xbe5691ef416bd60cULL,
+    0x8dd01fad907ffc3cULL, 0xd3515c2831559a83ULL, 0x9d71ac8fada6c9b5ULL,
+    0xea9c227723ee8bcbULL, 0xaecc49914078536dULL, 0x823c12795db6ce57ULL,
+    0xc21094364dfb5637ULL, 0x9096ea6f3848984fULL, 0xd77485cb25823ac7ULL,
+    0xa086cfcd97bf97f4ULL, 0xef340a98172aace5ULL, 0xb23867fb2a35b28eULL,
+    0x84c8d4dfd2c63f3bULL, 0xc5dd44271ad3cdbaULL, 0x936b9fcebb25c996ULL,
+    0xdbac6c247d62a584ULL, 0xa3ab66580d5fdaf6ULL, 0xf3e2f893dec3f126ULL,
+    0xb5b5ada8aaff80b8ULL, 0x87625f056c7c4a8bULL, 0xc9bcff6034c13053ULL,
+    0x964e858c91ba2655ULL, 0xdff9772470297ebdULL, 0xa6dfbd9fb8e5b88fULL,
+    0xf8a95fcf88747d94ULL, 0xb94470938fa89bcfULL, 0x8a08f0f8bf0f156bULL,
+    0xcdb02555653131b6ULL, 0x993fe2c6d07b7facULL, 0xe45c10c42a2b3b06ULL,
+    0xaa242499697392d3ULL, 0xfd87b5f28300ca0eULL, 0xbce5086492111aebULL,
+    0x8cbccc096f5088ccULL, 0xd1b71758e219652cULL, 0x9c40000000000000ULL,
+    0xe8d4a51000000000ULL, 0xad78ebc5ac620000ULL, 0x813f3978f8940984ULL,
+    0xc097ce7bc90715b3ULL, 0x8f7e32ce7bea5c70ULL, 0xd5d238a4abe98068ULL,
+    0x9f4f2726179a2245ULL, 0xed63a231d4c4fb27ULL, 0xb0de65388cc8ada8ULL,
+    0x83c7088e1aab65dbULL, 0xc45d1df942711d9aULL, 0x924d692ca61be758ULL,
+    0xda01ee641a708deaULL, 0xa26da3999aef774aULL, 0xf209787bb47d6b85ULL,
+    0xb454e4a179dd1877ULL, 0x865b86925b9bc5c2ULL, 0xc83553c5c8965d3dULL,
+    0x952ab45cfa97a0b3ULL, 0xde469fbd99a05fe3ULL, 0xa59bc234db398c25ULL,
+    0xf6c69a72a3989f5cULL, 0xb7dcbf5354e9beceULL, 0x88fcf317f22241e2ULL,
+    0xcc20ce9bd35c78a5ULL, 0x98165af37b2153dfULL, 0xe2a0b5dc971f303aULL,
+    0xa8d9d1535ce3b396ULL, 0xfb9b7cd9a4a7443cULL, 0xbb764c4ca7a44410ULL,
+    0x8bab8eefb6409c1aULL, 0xd01fef10a657842cULL, 0x9b10a4e5e9913129ULL,
+    0xe7109bfba19c0c9dULL, 0xac2820d9623bf429ULL, 0x80444b5e7aa7cf85ULL,
+    0xbf21e44003acdd2dULL, 0x8e679c2f5e44ff8fULL, 0xd433179d9c8cb841ULL,
+    0x9e19db92b4e31ba9ULL, 0xeb96bf6ebadf77d9ULL, 0xaf87023b9bf0ee6bULL
+};
+
+/**
+ * @brief Binary exponents of normalized powers of ten from 10^-348 to 10^340 with step 8.
+ */
+const int16_t POWERS_E[] = {
+    -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980,
+    -954, -927, -901, -874, -847, -821, -794, -768, -741, -715,
+    -688, -661, -635, -608, -582, -555, -529, -502, -475, -449,
+    -422, -396, -369, -343, -316, -289, -263, -236, -210, -183,
+    -157, -130, -103, -77, -50, -24, 3, 30, 56, 83,
+    109, 136, 162, 189, 216, 242, 269, 295, 322, 348,
+    375, 402, 428, 455, 481, 508, 534, 561, 588, 614,
+    641, 667, 694, 720, 747, 774, 800, 827, 853, 880,
+    907, 933, 960, 986, 1013, 1039, 1066
+};
+
+/**
+ * @brief Powers of ten.
+ */
+const uint64_t POWERS_10[] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 
+    100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL,
+    10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+    1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+};
+
+/**
+ * @struct Fp
+ * @brief Floating point number of 64-bit significand and binary exponent.
+ */
+struct Fp
+{
+    uint64_t f;
+    int32_t e;
+};
+
+/**
+ * @brief Formats an unsigned number.
+ *
+ * @param value  A number to format.
+ * @param buffer A buffer to format to.
+ * @return Number of characters.
+ */
+int32_t formatUnsigned(uint64_t value, char_t* const buffer)
+{
+    char_t digits[20];
+    int32_t index = 20;
+    while(value >= 100ULL)
+    {
+        int32_t const pair = static_cast<int32_t>(value % 100ULL) * 2;
+        value /= 100ULL;
+        digits[--index] = DIGIT_PAIRS[pair + 1];
+        digits[--index] = DIGIT_PAIRS[pair];
+    }
+    if(value >= 10ULL)
+    {
+        int32_t const pair = static_cast<int32_t>(value) * 2;
+        digits[--index] = DIGIT_PAIRS[pair + 1];
+        digits[--index] = DIGIT_PAIRS[pair];
+    }
+    else
+    {
+        digits[--index] = static_cast<char_t>('0' + static_cast<int32_t>(value));
+    }
+    int32_t const length = 20 - index;
+    for(int32_t i = 0; i < length; i++)
+    {
+        buffer[i] = digits[index + i];
+    }
+    buffer[length] = '\0';
+    return length;
+}
+
+/**
+ * @brief Formats a signed number.
+ *
+ * @param value  A number to format.
+ * @param buffer A buffer to format to.
+ * @return Number of characters.
+ */
+int32_t formatSigned(int64_t const value, char_t* const buffer)
+{
+    int32_t length = 0;
+    if(value < 0)
+    {
+        buffer[0] = '-';
+        // Negation of the unsigned value is correct for the minimum number as well
+        length = formatUnsigned(0ULL - static_cast<uint64_t>(value), &buffer[1]) + 1;
+    }
+    else
+    {
+        length = formatUnsigned(static_cast<uint64_t>(value), buffer);
+    }
+    return length;
+}
+
+/**
+ * @brief Normalizes a floating point number.
+ *
+ * @param x A number with non-zero significand.
+ * @return The number with the highest bit of significand set.
+ */
+Fp normalize(Fp x)
+{
+    // Binary search of the highest set bit shifts six times at most
+    int32_t shift = 32;
+    while(shift > 0)
+    {
+        if( (x.f >> (64 - shift)) == 0ULL )
+        {
+            x.f <<= shift;
+            x.e -= shift;
+        }
+        shift >>= 1;
+    }
+    return x;
+}
+
+/**
+ * @brief Multiplies two floating point numbers rounding the result.
+ *
+ * @param x A multiplicand.
+ * @param y A multiplier.
+ * @return The product.
+ */
+Fp multiply(Fp const& x, Fp const& y)
+{
+    uint64_t const m32 = 0xFFFFFFFFULL;
+    uint64_t const a = x.f >> 32;
+    uint64_t const b = x.f & m32;
+    uint64_t const c = y.f >> 32;
+    uint64_t const d = y.f & m32;
+    uint64_t const ac = a * c;
+    uint64_t const bc = b * c;
+    uint64_t const ad = a * d;
+    uint64_t const bd = b * d;
+    uint64_t tmp = (bd >> 32) + (ad & m32) + (bc & m32);
+    tmp += 1ULL << 31;
+    Fp const r = { ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), x.e + y.e + 64 };
+    return r;
+}
+
+/**
+ * @brief Returns a cached power of ten for a binary exponent.
+ *
+ * @param e A binary exponent of a normalized number.
+ * @param k A decimal exponent of the power returned.
+ * @return The power of ten which product with the number has binary exponent in range [-60, -32].
+ */
+Fp getCachedPower(int32_t const e, int32_t& k)
+{
+    // The ceiling of (-61 - e) * log10(2) + 347 calculated with log10(2) * 2^32 in integers
+    int64_t const x = static_cast<int64_t>(-61 - e) * 1292913987LL;
+    int64_t const q = (x >= 0LL) ? ( (x + 4294967295LL) >> 32 ) : -( (-x) >> 32 );
+    int32_t const dk = static_cast<int32_t>(q) + 347;
+    int32_t const index = dk / 8 + 1;
+    k = 348 - index * 8;
+    Fp const r = { POWERS_F[index], static_cast<int32_t>(POWERS_E[index]) };
+    return r;
+}
+
+/**
+ * @brief Rounds a last generated digit to the closest to the number.
+ */
+void round(char_t* const buffer, int32_t const length, uint64_t const delta, uint64_t rest, uint64_t const tenKappa, uint64_t const wpw)
+{
+    while( (rest < wpw) && (delta - rest >= tenKappa) && ( (rest + tenKappa < wpw) || (wpw - rest > rest + tenKappa - wpw) ) )
+    {
+        buffer[length - 1]--;
+        rest += tenKappa;
+    }
+}
+
+/**
+ * @brief Generates the shortest digits in the boundaries.
+ *
+ * @param w      A scaled number.
+ * @param mp     A scaled upper boundary.
+ * @param delta  A distance between the upper and lower boundaries.
+ * @param buffer A buffer of digits.
+ * @param k      A decimal exponent to be corrected.
+ * @return Number of digits.
+ */
+int32_t generate(Fp const& w, Fp const& mp, uint64_t delta, char_t* const buffer, int32_t& k)
+{
+    int32_t const shift = -mp.e;
+    uint64_t const one = 1ULL << shift;
+    uint64_t const wpw = mp.f - w.f;
+    uint32_t p1 = static_cast<uint32_t>(mp.f >> shift);
+    uint64_t p2 = mp.f & (one - 1ULL);
+    int32_t kappa = 10;
+    while( (kappa > 1) && (static_cast<uint64_t>(p1) < POWERS_10[kappa - 1]) )
+    {
+        kappa--;
+    }
+    int32_t length = 0;
+    while(kappa > 0)
+    {
+        uint32_t const power = static_cast<uint32_t>(POWERS_10[kappa - 1]);
+        uint32_t const d = p1 / power;
+        p1 %= power;
+        if( (d != 0U) || (length != 0) )
+        {
+            buffer[length++] = static_cast<char_t>('0' + static_cast<int32_t>(d));
+        }
+        kappa--;
+        uint64_t const rest = (static_cast<uint64_t>(p1) << shift) + p2;
+        if(rest <= delta)
+        {
+            k += kappa;
+            round(buffer, length, delta, rest, POWERS_10[kappa] << shift, wpw);
+            return length;
+        }
+    }
+    while(true)
+    {
+        p2 *= 10ULL;
+        delta *= 10ULL;
+        uint32_t const d = static_cast<uint32_t>(p2 >> shift);
+        if( (d != 0U) || (length != 0) )
+        {
+            buffer[length++] = static_cast<char_t>('0' + static_cast<int32_t>(d));
+        }
+        p2 &= one - 1ULL;
+        kappa--;
+        if(p2 < delta)
+        {
+            k += kappa;
+            int32_t const index = -kappa;
+            round(buffer, length, delta, p2, one, wpw * ( (index < 20) ? POWERS_10[index] : 0ULL ));
+            return length;
+        }
+    }
+}
+
+/**
+ * @brief Places digits and a decimal exponent to a buffer.
+ *
+ * @param buffer A buffer containing digits.
+ * @param length Number of digits.
+ * @param k      A decimal exponent of the last digit.
+ * @return Number of characters.
+ */
+int32_t place(char_t* const buffer, int32_t const length, int32_t const k)
+{
+    int32_t const point = length + k;
+    int32_t size = 0;
+    if( (k >= 0) && (point <= 21) )
+    {
+        // 1234e7 -> 12340000000
+        for(int32_t i = length; i < point; i++)
+        {
+            buffer[i] = '0';
+        }
+        size = point;
+    }
+    else if( (point > 0) && (point <= 21) )
+    {
+        // 1234e-2 -> 12.34
+        for(int32_t i = length; i > point; i--)
+        {
+            buffer[i] = buffer[i - 1];
+        }
+        buffer[point] = '.';
+        size = length + 1;
+    }
+    else if( (point > -6) && (point <= 0) )
+    {
+        // 1234e-6 -> 0.001234
+        int32_t const offset = 2 - point;
+        for(int32_t i = length - 1; i >= 0; i--)
+        {
+            buffer[i + offset] = buffer[i];
+        }
+        buffer[0] = '0';
+        buffer[1] = '.';
+        for(int32_t i = 2; i < offset; i++)
+        {
+            buffer[i] = '0';
+        }
+        size = length + offset;
+    }
+    else
+    {
+        // 1234e30 -> 1.234e+33
+        size = length;
+        if(length > 1)
+        {
+            for(int32_t i = length; i > 1; i--)
+            {
+                buffer[i] = buffer[i - 1];
+            }
+            buffer[1] = '.';
+            size++;
+        }
+        buffer[size++] = 'e';
+        int32_t exponent = point - 1;
+        if(exponent < 0)
+        {
+            buffer[size++] = '-';
+            exponent = -exponent;
+        }
+        else
+        {
+            buffer[size++] = '+';
+        }
+        size += formatUnsigned(static_cast<uint64_t>(exponent), &buffer[size]);
+    }
+    buffer[size] = '\0';
+    return size;
+}
+
+/**
+ * @brief Formats a floating point number.
+ *
+ * @param isNegative True if the number is negative.
+ * @param fraction   A fraction field of the number.
+ * @param exponent   A biased exponent field of the number.
+ * @param digits     Number of bits of the fraction field.
+ * @param bias       An exponent bias of the number.
+ * @param buffer     A buffer to format to.
+ * @return Number of characters.
+ */
+int32_t formatFloat(bool_t const isNegative, uint64_t const fraction, int32_t const exponent, int32_t const digits, int32_t const bias, char_t* buffer)
+{
+    int32_t length = 0;
+    if(isNegative)
+    {
+        buffer[length++] = '-';
+    }
+    uint64_t const hidden = 1ULL << digits;
+    int32_t const maximum = bias * 2 + 1;
+    if(exponent == maximum)
+    {
+        char_t const* const string = (fraction == 0ULL) ? "inf" : "nan";
+        // NaN has no sign
+        length = (fraction == 0ULL) ? length : 0;
+        for(int32_t i = 0; i < 3; i++)
+        {
+            buffer[length++] = string[i];
+        }
+        buffer[length] = '\0';
+    }
+    else if( (exponent == 0) && (fraction == 0ULL) )
+    {
+        buffer[length++] = '0';
+        buffer[length] = '\0';
+    }
+    else
+    {
+        Fp v;
+        if(exponent != 0)
+        {
+            v.f = fraction + hidden;
+            v.e = exponent - bias - digits;
+        }
+        else
+        {
+            v.f = fraction;
+            v.e = 1 - bias - digits;
+        }
+        Fp const p = { (v.f << 1) + 1ULL, v.e - 1 };
+        Fp const mp = normalize(p);
+        Fp mm;
+        if( (v.f == hidden) && (exponent > 1) )
+        {
+            // The lower boundary is closer as the lower exponent has twice less step
+            mm.f = (v.f << 2) - 1ULL;
+            mm.e = v.e - 2;
+        }
+        else
+        {
+            mm.f = (v.f << 1) - 1ULL;
+            mm.e = v.e - 1;
+        }
+        mm.f <<= mm.e - mp.e;
+        mm.e = mp.e;
+        int32_t k = 0;
+        Fp const c = getCachedPower(mp.e, k);
+        Fp const w = multiply(normalize(v), c);
+        Fp wp = multiply(mp, c);
+        Fp wm = multiply(mm, c);
+        wm.f++;
+        wp.f--;
+        char_t* const digitsBuffer = &buffer[length];
+        int32_t const number = generate(w, wp, wp.f - wm.f, digitsBuffer, k);
+        length += place(digitsBuffer, number, k);
+    }
+    return length;
+}
+
+} // namespace
+
+int32_t Formatter::format(int32_t const value, char_t* const buffer)
+{
+    return formatSigned(static_cast<int64_t>(value), buffer);
+}
+
+int32_t Formatter::format(uint32_t const value, char_t* const buffer)
+{
+    return formatUnsigned(static_cast<uint64_t>(value), buffer);
+}
+
+int32_t Formatter::format(int64_t const value, char_t* const buffer)
+{
+    return formatSigned(value, buffer);
+}
+
+int32_t Formatter::format(uint64_t const value, char_t* const buffer)
+{
+    return formatUnsigned(value, buffer);
+}
+
+int32_t Formatter::format(float32_t const value, char_t* const buffer)
+{
+    uint32_t bits;
+    static_cast<void>( std::memcpy(&bits, &value, sizeof(bits)) );
+    uint64_t const fraction = static_cast<uint64_t>(bits & 0x007FFFFFU);
+    int32_t const exponent = static_cast<int32_t>( (bits >> 23) & 0xFFU );
+    return formatFloat( (bits >> 31) != 0U, fraction, exponent, 23, 127, buffer);
+}
+
+int32_t Formatter::format(float64_t const value, char_t* const buffer)
+{
+    uint64_t bits;
+    static_cast<void>( std::memcpy(&bits, &value, sizeof(bits)) );
+    uint64_t const fraction = bits & 0x000FFFFFFFFFFFFFULL;
+    int32_t const exponent = static_cast<int32_t>( (bits >> 52) & 0x7FFULL );
+    return formatFloat( (bits >> 63) != 0ULL, fraction, exponent, 52, 1023, buffer);
+}
+
+} // namespace eoos